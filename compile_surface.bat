@@ -1,5 +1,5 @@
-cd src
-g++ -O3 -m64 -IC:\Strawberry\c\include -LC:\Strawberry\c\lib -g -o ../bin/Surface.exe Main_Surface.cpp Transform.cpp Shader.cpp Curve.c Sphere.c Surface.c Vec.c Quaternion.c Object.c Matrix.c Image.c Buffer.cpp Skybox.cpp Texture.cpp Cylinder.c -lglfw3 -lglew32 -lgdi32 -lopengl32 -lpthread
-pause
-cd ../
-cls
+cd src
+g++ -O3 -m64 -IC:\Strawberry\c\include -LC:\Strawberry\c\lib -g -o ../bin/Surface.exe Main_Surface.cpp Transform.cpp Shader.cpp Curve.c Sphere.c Surface.c Vec.c Quaternion.c Object.c Matrix.c Image.c Buffer.cpp MeshCache.cpp MeshCodec.c Arena.c Frustum.c Skybox.cpp Texture.cpp Cylinder.c ThreadPool.c Terrain.c -lglfw3 -lglew32 -lgdi32 -lopengl32 -lpthread
+pause
+cd ../
+cls
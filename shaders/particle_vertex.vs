@@ -1,49 +1,63 @@
-#version 330 core
-
-#define G vec3(0.0, -9.81, 0.0)
-
-layout(location = 0) in vec3  a_Position;    // Vertex position
-layout(location = 1) in vec3  a_Normal;   	 // Vertex normal
-layout(location = 2) in vec3  a_Color; 		 // Object color
-layout(location = 3) in vec3  a_Specular; 	 // Object specular color
-layout(location = 4) in float a_Shininess;   // Object shininess
-layout(location = 5) in float a_Reflect;     // Object reflectivness
-
-out vec3  FragPos;    // FragPos in world space
-out vec3  Normal;     // Normal in world space
-out vec3  Color;      // Object color
-out vec3  Specular_color;
-out float Shininess;
-out float Reflection;
-
-uniform mat4 u_model; 			// Model matrix
-uniform mat4 u_view;  			// View matrix
-uniform mat4 u_projection; 		// Projection matrix
-
-uniform float u_time;
-uniform float u_CX;
-uniform float u_S;
-uniform float u_air_density;
-uniform vec3 u_initial_speed;
-
-void main() {
-    // Calculate the new position based on physics simulation
-    vec3 v = G * u_time + u_initial_speed;
-    vec3 R = 0.5 * u_CX * u_air_density * u_S * length(v) * length(v) * normalize(v);
-    
-    // Calculate the net force acting on the particle
-    vec3 netForce = G - R;
-
-    // Calculate the new position using the net force
-    vec3 pos = a_Position + (u_initial_speed * u_time) + 0.5 * netForce * u_time * u_time;
-
-    FragPos = vec3(u_model * vec4(pos, 1.0));
-    Normal = mat3(transpose(inverse(u_model))) * a_Normal;
-
-    Color = a_Color;
-    Specular_color = a_Specular;
-    Shininess = a_Shininess;
-    Reflection = a_Reflect;
-
-    gl_Position = u_projection * u_view * vec4(FragPos, 1.0);
+#version 330 core
+
+#define G vec3(0.0, -9.81, 0.0)
+
+layout(location = 0) in vec3  a_Position;    // Vertex position
+layout(location = 1) in vec3  a_Normal;   	 // Vertex normal
+layout(location = 2) in vec3  a_Color; 		 // Object color
+layout(location = 3) in vec3  a_Specular; 	 // Object specular color
+layout(location = 4) in float a_Shininess;   // Object shininess
+layout(location = 5) in float a_Reflect;     // Object reflectivness
+// 2 to 5 are constant for the whole draw with compact objects (see Buffer_draw)
+layout(location = 8) in vec4  a_Dequantize;  // center and scale of quantized positions, constant
+layout(location = 9) in float a_OctNormal;   // 1 when a_Normal.xy is an octahedral normal, constant
+
+out vec3  FragPos;    // FragPos in world space
+out vec3  Normal;     // Normal in world space
+out vec3  Color;      // Object color
+out vec3  Specular_color;
+out float Shininess;
+out float Reflection;
+
+uniform mat4 u_model; 			// Model matrix
+uniform mat4 u_view;  			// View matrix
+uniform mat4 u_projection; 		// Projection matrix
+
+uniform float u_time;
+uniform float u_CX;
+uniform float u_S;
+uniform float u_air_density;
+uniform vec3 u_initial_speed;
+
+// unfold the octahedron of Object_quantize back on the unit sphere
+vec3 octDecode(vec2 e) {
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += vec2(n.x >= 0.0 ? -t : t, n.y >= 0.0 ? -t : t);
+    return normalize(n);
+}
+
+void main() {
+    vec3 position = a_Dequantize.xyz + a_Dequantize.w * a_Position;
+    vec3 normal = (a_OctNormal > 0.5) ? octDecode(a_Normal.xy) : a_Normal;
+
+    // Calculate the new position based on physics simulation
+    vec3 v = G * u_time + u_initial_speed;
+    vec3 R = 0.5 * u_CX * u_air_density * u_S * length(v) * length(v) * normalize(v);
+    
+    // Calculate the net force acting on the particle
+    vec3 netForce = G - R;
+
+    // Calculate the new position using the net force
+    vec3 pos = position + (u_initial_speed * u_time) + 0.5 * netForce * u_time * u_time;
+
+    FragPos = vec3(u_model * vec4(pos, 1.0));
+    Normal = mat3(transpose(inverse(u_model))) * normal;
+
+    Color = a_Color;
+    Specular_color = a_Specular;
+    Shininess = a_Shininess;
+    Reflection = a_Reflect;
+
+    gl_Position = u_projection * u_view * vec4(FragPos, 1.0);
 }
\ No newline at end of file
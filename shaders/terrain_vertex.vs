@@ -0,0 +1,43 @@
+#version 330 core
+layout(location = 0) in vec3  a_Position;    // Vertex position
+layout(location = 1) in vec3  a_Normal;   	 // Vertex normal
+layout(location = 2) in vec3  a_Color; 		 // Object color
+layout(location = 3) in vec3  a_Specular; 	 // Object specular color
+layout(location = 4) in float a_Shininess;   // Object shininess
+layout(location = 5) in float a_Reflect;     // Object reflectivness
+layout(location = 6) in float a_MorphHeight; // Height on the next level of detail
+layout(location = 7) in vec3  a_MorphNormal; // Normal on the next level of detail
+
+out vec3  FragPos;    // FragPos in world space
+out vec3  Normal;     // Normal in world space
+out vec3  Color;      // Object color
+out vec3  Specular_color;
+out float Shininess;
+out float Reflection;
+
+uniform mat4 u_model; 			// Model matrix
+uniform mat4 u_view;  			// View matrix
+uniform mat4 u_projection; 		// Projection matrix
+uniform vec3 u_viewPos;         // View position
+
+uniform float u_morphStart;     // Distance where the chunk starts to morph (TerrainChunk)
+uniform float u_morphEnd;       // Distance where it matches the next level
+
+void main() {
+
+    vec3 position = vec3(u_model * vec4(a_Position, 1.0));
+    float morph = clamp( (distance(position, u_viewPos) - u_morphStart) / max(u_morphEnd - u_morphStart, 1e-6), 0.0, 1.0 );
+
+    vec3 morphed = vec3(a_Position.x, mix(a_Position.y, a_MorphHeight, morph), a_Position.z);
+
+    FragPos = vec3(u_model * vec4(morphed, 1.0));
+    Normal = mat3(transpose(inverse(u_model))) * normalize( mix(a_Normal, a_MorphNormal, morph) );
+
+    Color = a_Color; // Pass the color to the fragment shader
+    Specular_color = a_Specular;
+    Shininess = a_Shininess;
+    Reflection = a_Reflect;
+
+    gl_Position = u_projection * u_view * vec4(FragPos, 1.0);
+
+}
\ No newline at end of file
@@ -0,0 +1,161 @@
+#include "Arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#define ARENA_MAX_DEPTH 16
+
+//scopes of the current thread
+static __thread Arena * arena_scopes[ARENA_MAX_DEPTH];
+static __thread unsigned int arena_depth = 0;
+
+static ArenaBlock * block_create(size_t size)
+{
+    void * memory = NULL;
+#ifdef _WIN32
+    memory = _aligned_malloc(ARENA_ALIGN + size, ARENA_ALIGN);
+#else
+    if (posix_memalign(&memory, ARENA_ALIGN, ARENA_ALIGN + size) != 0)
+        memory = NULL;
+#endif
+    if (!memory) {
+        fprintf(stderr, "Error: Memory allocation failed for arena block.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ArenaBlock * b = (ArenaBlock *) memory;
+    b->next = NULL;
+    b->size = size;
+    b->used = 0;
+    return b;
+}
+
+static void block_free(ArenaBlock * b)
+{
+#ifdef _WIN32
+    _aligned_free(b);
+#else
+    free(b);
+#endif
+}
+
+Arena * Arena_init(size_t block_size)
+{
+    Arena * a = (Arena *) calloc(1, sizeof(Arena));
+    if (!a) {
+        fprintf(stderr, "Error: Memory allocation failed for arena.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    a->block_size = (block_size + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+    if (a->block_size == 0)
+        a->block_size = 1 << 20;
+
+    return a;
+}
+
+void * Arena_alloc(Arena * a, size_t count, size_t size)
+{
+    if (size != 0 && count > ((size_t) -1 - ARENA_ALIGN) / size) {
+        fprintf(stderr, "Error: Arena allocation of %u x %u bytes is too large.\n", (unsigned int) count, (unsigned int) size);
+        exit(EXIT_FAILURE);
+    }
+
+    if (!a)
+    {
+        void * p = calloc(count ? count : 1, size ? size : 1);
+        if (!p) {
+            fprintf(stderr, "Error: Memory allocation failed.\n");
+            exit(EXIT_FAILURE);
+        }
+        return p;
+    }
+
+    size_t bytes = (count * size + ARENA_ALIGN - 1) / ARENA_ALIGN * ARENA_ALIGN;
+    if (bytes == 0)
+        bytes = ARENA_ALIGN;
+
+    ArenaBlock * b = a->current;
+    if (!b || b->used + bytes > b->size)
+    {
+        //next block kept from before a reset, or a new one inserted after the current one
+        if (b && b->next && b->next->size >= bytes)
+        {
+            b = b->next;
+            b->used = 0;
+        }
+        else
+        {
+            ArenaBlock * n = block_create((bytes > a->block_size) ? bytes : a->block_size);
+            if (b)
+            {
+                n->next = b->next;
+                b->next = n;
+            }
+            else
+            {
+                n->next = a->first;
+                a->first = n;
+            }
+            b = n;
+        }
+        a->current = b;
+    }
+
+    unsigned char * p = (unsigned char *) b + ARENA_ALIGN + b->used;
+    b->used += bytes;
+    memset(p, 0, bytes);
+    return p;
+}
+
+void Arena_release(Arena * a, void * p)
+{
+    if (!a)
+        free(p);
+}
+
+void Arena_reset(Arena * a)
+{
+    a->current = a->first;
+    if (a->first)
+        a->first->used = 0;
+}
+
+void Arena_free(Arena * a)
+{
+    if (!a)
+        return;
+
+    ArenaBlock * b = a->first;
+    while (b)
+    {
+        ArenaBlock * next = b->next;
+        block_free(b);
+        b = next;
+    }
+    free(a);
+}
+
+void Arena_begin(Arena * a)
+{
+    if (arena_depth == ARENA_MAX_DEPTH) {
+        fprintf(stderr, "Error: Too many nested arena scopes.\n");
+        exit(EXIT_FAILURE);
+    }
+    arena_scopes[arena_depth++] = a;
+}
+
+void Arena_end()
+{
+    if (arena_depth > 0)
+        arena_depth--;
+}
+
+Arena * Arena_current()
+{
+    return (arena_depth > 0) ? arena_scopes[arena_depth - 1] : NULL;
+}
\ No newline at end of file
@@ -0,0 +1,100 @@
+/**
+ * @file Arena.h
+ * @brief Header for struct Arena
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 19-10-2026
+ *
+ * Header pour les arènes d'allocation (objets et intermédiaires libérés d'un coup)
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#define ARENA_ALIGN 64
+
+/**
+ * @struct ArenaBlock
+ * @brief chunk of memory of an arena, its data starts ARENA_ALIGN bytes after it
+ */
+typedef struct ArenaBlock
+{
+    struct ArenaBlock * next;
+    size_t size;                //bytes of data
+    size_t used;
+} ArenaBlock;
+
+/**
+ * @struct Arena
+ * @brief blocks handed out in order, everything is released at once by Arena_reset or Arena_free
+ * an arena is not thread safe : allocate from the thread that owns it
+ */
+typedef struct Arena
+{
+    ArenaBlock * first;
+    ArenaBlock * current;       //blocks after it are kept from before a reset
+    size_t block_size;
+} Arena;
+
+/**
+ * @brief create an arena, no memory is taken before the first allocation
+ *
+ * @param block_size bytes of each block (larger allocations get a block of their own)
+ * @return Arena*
+ */
+Arena * Arena_init(size_t block_size);
+
+/**
+ * @brief zeroed memory aligned on ARENA_ALIGN bytes, from the arena or from calloc when it is NULL
+ *
+ * @param a can be NULL
+ * @param count
+ * @param size
+ * @return void*
+ */
+void * Arena_alloc(Arena * a, size_t count, size_t size);
+
+/**
+ * @brief give back memory from Arena_alloc : free when a is NULL, nothing otherwise (it goes with the arena)
+ *
+ * @param a
+ * @param p
+ */
+void Arena_release(Arena * a, void * p);
+
+/**
+ * @brief forget every allocation in O(1), the blocks are reused
+ *
+ * @param a
+ */
+void Arena_reset(Arena * a);
+
+/**
+ * @brief free the blocks and the arena
+ *
+ * @param a
+ */
+void Arena_free(Arena * a);
+
+/**
+ * @brief until Arena_end, the objects, curves and surfaces created by this thread (generators included)
+ * take their memory from the arena, scopes can be nested, NULL opens a scope on the heap
+ * (the tasks of the thread pool run in such a scope, even when the waiting thread runs them)
+ *
+ * @param a
+ */
+void Arena_begin(Arena * a);
+
+/**
+ * @brief end the scope of the last Arena_begin
+ */
+void Arena_end();
+
+/**
+ * @brief arena of the current scope of this thread, NULL outside of any
+ *
+ * @return Arena*
+ */
+Arena * Arena_current();
\ No newline at end of file
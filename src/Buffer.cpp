@@ -1,105 +1,215 @@
-#include "Buffer.h"
-#include <stdio.h>
-#include <stdlib.h>
-
-Buffer * Buffer_init(Object * obj)
-{
-    Buffer * buf = (Buffer *) calloc(1, sizeof(Buffer) );
-    if (!buf) {
-        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    buf->VAO = 0;
-    buf->VBO = 0;
-    buf->EBO = 0;
-    buf->object = obj;
-
-    glGenVertexArrays(1, &buf->VAO);
-    glGenBuffers(1, &buf->VBO);
-
-    // Bind the VAO
-    glBindVertexArray(buf->VAO);
-
-    unsigned char i;
-    unsigned char size = 0;
-    for (i = 0; i < obj->n_attributes; i++)
-        size += obj->layout[i];
-
-    // Bind the VBO and set vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, buf->VBO);
-    glBufferData(GL_ARRAY_BUFFER, obj->n_points * size * sizeof(float), obj->vertexBuffer, GL_STATIC_DRAW);
-
-    unsigned short stride = 0;
-    for (i = 0; i < obj->n_attributes; i++)
-    {
-        glVertexAttribPointer(i, obj->layout[i], GL_FLOAT, GL_FALSE, size * sizeof(float), (void*)(stride * sizeof(float) ));
-        glEnableVertexAttribArray(i);
-        stride += obj->layout[i];
-    }
-
-    // Generate an Element Buffer Object (EBO) for the cube indices
-    glGenBuffers(1, &buf->EBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf->EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, obj->n_faces * 3 * sizeof(unsigned int), obj->indexBuffer, GL_STATIC_DRAW);
-
-    // Unbind VAO and VBO and EBO
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-    return buf;
-}
-
-void Buffer_update(Object * obj, Buffer * buf)
-{
-    if (!buf) {
-        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    buf->VAO = 0;
-    buf->VBO = 0;
-    buf->EBO = 0;
-    buf->object = obj;
-
-    glGenVertexArrays(1, &buf->VAO);
-    glGenBuffers(1, &buf->VBO);
-
-    // Bind the VAO
-    glBindVertexArray(buf->VAO);
-
-    unsigned char i;
-    unsigned char size = 0;
-    for (i = 0; i < obj->n_attributes; i++)
-        size += obj->layout[i];
-
-    // Bind the VBO and set vertex data
-    glBindBuffer(GL_ARRAY_BUFFER, buf->VBO);
-    glBufferData(GL_ARRAY_BUFFER, obj->n_points * size * sizeof(float), obj->vertexBuffer, GL_STATIC_DRAW);
-
-    unsigned short stride = 0;
-    for (i = 0; i < obj->n_attributes; i++)
-    {
-        glVertexAttribPointer(i, obj->layout[i], GL_FLOAT, GL_FALSE, size * sizeof(float), (void*)(stride * sizeof(float) ));
-        glEnableVertexAttribArray(i);
-        stride += obj->layout[i];
-    }
-
-    // Generate an Element Buffer Object (EBO) for the cube indices
-    glGenBuffers(1, &buf->EBO);
-    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf->EBO);
-    glBufferData(GL_ELEMENT_ARRAY_BUFFER, obj->n_faces * 3 * sizeof(unsigned int), obj->indexBuffer, GL_STATIC_DRAW);
-
-    // Unbind VAO and VBO and EBO
-    glBindBuffer(GL_ARRAY_BUFFER, 0);
-}
-
-void Buffer_bind(const Buffer * buf)
-{
-    glBindVertexArray(buf->VAO);
-}
-
-void Buffer_draw(const Buffer * buf)
-{
-    Buffer_bind(buf);
-    glDrawElements(GL_TRIANGLES, buf->object->n_faces * 3, GL_UNSIGNED_INT, 0);
+#include "Buffer.h"
+#include "VertexFormat.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+
+// bind the EBO to the bound VAO, shared grid indices are uploaded only once for every object using them
+static void bind_indices(Buffer * buf, Object * obj)
+{
+    if (obj->grid)
+    {
+        GridIndices * grid = obj->grid;
+        if (grid->EBO == 0)
+        {
+            glGenBuffers(1, &grid->EBO);
+            glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, grid->EBO);
+            glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr) grid->count * grid->index_size, grid->data, GL_STATIC_DRAW);
+        }
+        buf->EBO = grid->EBO;
+        buf->index_type = (grid->index_size == 2) ? GL_UNSIGNED_SHORT : GL_UNSIGNED_INT;
+        buf->owns_ebo = false;
+        glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf->EBO);
+        return;
+    }
+
+    buf->owns_ebo = true;
+    glGenBuffers(1, &buf->EBO);
+    glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, buf->EBO);
+
+    //owned indices stay 32 bits in memory, they are narrowed for the upload when every vertex fits in 16 bits
+    unsigned short * narrow = (obj->n_points <= 65536) ? (unsigned short *) malloc((size_t) obj->n_faces * 3 * sizeof(unsigned short)) : NULL;
+    if (narrow)
+    {
+        for (size_t k = 0; k < (size_t) obj->n_faces * 3; k++)
+            narrow[k] = (unsigned short) obj->indexBuffer[k];
+
+        buf->index_type = GL_UNSIGNED_SHORT;
+        glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr) obj->n_faces * 3 * sizeof(unsigned short), narrow, GL_STATIC_DRAW);
+        free(narrow);
+        return;
+    }
+
+    buf->index_type = GL_UNSIGNED_INT;
+    glBufferData(GL_ELEMENT_ARRAY_BUFFER, (GLsizeiptr) obj->n_faces * 3 * sizeof(unsigned int), obj->indexBuffer, GL_STATIC_DRAW);
+}
+
+// one pointer per attribute of the layout, quantized attributes are read normalized
+// attribute index of the bound VAO, offset in words of the vertex
+static void bind_attribute(unsigned char index, unsigned char type, unsigned char count, unsigned int offset, unsigned int stride)
+{
+    if (type == ATTRIBUTE_SNORM16 || type == ATTRIBUTE_OCT16)
+        glVertexAttribPointer(index, count, GL_SHORT, GL_TRUE, stride, (void*)(offset * sizeof(float) ));
+    else if (type == ATTRIBUTE_UNORM8)
+        glVertexAttribPointer(index, count, GL_UNSIGNED_BYTE, GL_TRUE, stride, (void*)(offset * sizeof(float) ));
+    else
+        glVertexAttribPointer(index, count, GL_FLOAT, GL_FALSE, stride, (void*)(offset * sizeof(float) ));
+
+    glEnableVertexAttribArray(index);
+}
+
+// the known formats are set up from their compile time description, any other layout is read from the object
+static void bind_attributes(const Object * obj)
+{
+    if (StandardVertexFormat::matches(obj))
+        StandardVertexFormat::forEachAttribute(bind_attribute);
+    else if (CompactVertexFormat::matches(obj))
+        CompactVertexFormat::forEachAttribute(bind_attribute);
+    else if (QuantizedVertexFormat::matches(obj))
+        QuantizedVertexFormat::forEachAttribute(bind_attribute);
+    else if (QuantizedCompactVertexFormat::matches(obj))
+        QuantizedCompactVertexFormat::forEachAttribute(bind_attribute);
+    else if (TerrainVertexFormat::matches(obj))
+        TerrainVertexFormat::forEachAttribute(bind_attribute);
+    else
+    {
+        unsigned int stride = Object_vertexSize(obj) * sizeof(float);
+        unsigned int offset = 0;
+
+        for (unsigned char i = 0; i < obj->n_attributes; i++)
+        {
+            unsigned char type = obj->types ? obj->types[i] : ATTRIBUTE_FLOAT;
+            unsigned char count = (type == ATTRIBUTE_OCT16) ? 2 : obj->layout[i];
+
+            bind_attribute(i, type, count, offset, stride);
+            offset += Object_attributeSize(obj, i);
+        }
+    }
+}
+
+Buffer * Buffer_init(Object * obj)
+{
+    Buffer * buf = (Buffer *) calloc(1, sizeof(Buffer) );
+    if (!buf) {
+        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    buf->VAO = 0;
+    buf->VBO = 0;
+    buf->EBO = 0;
+    buf->object = obj;
+
+    glGenVertexArrays(1, &buf->VAO);
+    glGenBuffers(1, &buf->VBO);
+
+    // Bind the VAO
+    glBindVertexArray(buf->VAO);
+
+    unsigned int size = Object_vertexSize(obj);
+
+    // Bind the VBO and set vertex data
+    glBindBuffer(GL_ARRAY_BUFFER, buf->VBO);
+    glBufferData(GL_ARRAY_BUFFER, obj->n_points * size * sizeof(float), obj->vertexBuffer, GL_STATIC_DRAW);
+
+    bind_attributes(obj);
+
+    // Element Buffer Object (EBO): its own indices, or the shared copy of the grid indices
+    bind_indices(buf, obj);
+
+    // Unbind VAO and VBO and EBO
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    return buf;
+}
+
+void Buffer_update(Object * obj, Buffer * buf)
+{
+    if (!buf) {
+        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    buf->VAO = 0;
+    buf->VBO = 0;
+    buf->EBO = 0;
+    buf->object = obj;
+
+    glGenVertexArrays(1, &buf->VAO);
+    glGenBuffers(1, &buf->VBO);
+
+    // Bind the VAO
+    glBindVertexArray(buf->VAO);
+
+    unsigned int size = Object_vertexSize(obj);
+
+    // Bind the VBO and set vertex data
+    glBindBuffer(GL_ARRAY_BUFFER, buf->VBO);
+    glBufferData(GL_ARRAY_BUFFER, obj->n_points * size * sizeof(float), obj->vertexBuffer, GL_STATIC_DRAW);
+
+    bind_attributes(obj);
+
+    // Element Buffer Object (EBO): its own indices, or the shared copy of the grid indices
+    bind_indices(buf, obj);
+
+    // Unbind VAO and VBO and EBO
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void Buffer_updateRange(Buffer * buf, unsigned int first, unsigned int count)
+{
+    Object * obj = buf->object;
+    if (count == 0 || first >= obj->n_points)
+        return;
+
+    if (first + count > obj->n_points)
+        count = obj->n_points - first;
+
+    unsigned int size = Object_vertexSize(obj);
+
+    glBindBuffer(GL_ARRAY_BUFFER, buf->VBO);
+    glBufferSubData(GL_ARRAY_BUFFER, (GLintptr) first * size * sizeof(float), (GLsizeiptr) count * size * sizeof(float), obj->vertexBuffer + (size_t) first * size);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+}
+
+void Buffer_bind(const Buffer * buf)
+{
+    glBindVertexArray(buf->VAO);
+}
+
+void Buffer_draw(const Buffer * buf)
+{
+    Buffer_bind(buf);
+
+    // the arrays 2 to 5 of a compact object are disabled, the shader reads these constant values instead
+    const Object * obj = buf->object;
+    if (obj->compact)
+    {
+        glVertexAttrib3fv(2, obj->material.color);
+        glVertexAttrib3fv(3, obj->material.specular);
+        glVertexAttrib1f(4, obj->material.shininess);
+        glVertexAttrib1f(5, obj->material.reflection);
+    }
+
+    // positions of a quantized object are center + scale * position, its normals are octahedral
+    if (obj->types)
+        glVertexAttrib4fv(8, obj->dequantization);
+    else
+        glVertexAttrib4f(8, 0.0f, 0.0f, 0.0f, 1.0f);
+    glVertexAttrib1f(9, (obj->types && obj->types[1] == ATTRIBUTE_OCT16) ? 1.0f : 0.0f);
+
+    glDrawElements(GL_TRIANGLES, buf->object->n_faces * 3, buf->index_type, 0);
+}
+
+void Buffer_free(Buffer * buf)
+{
+    if (!buf)
+        return;
+
+    //the EBO of shared grid indices belongs to the grid cache, whatever the object became since
+    glDeleteVertexArrays(1, &buf->VAO);
+    glDeleteBuffers(1, &buf->VBO);
+    if (buf->owns_ebo && buf->EBO)
+        glDeleteBuffers(1, &buf->EBO);
+
+    free(buf);
 }
\ No newline at end of file
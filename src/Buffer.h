@@ -1,66 +1,88 @@
-/**
- * @file Buffer.h
- * @brief Header for struct Buffer
- * @author Antony Madaleno
- * @version 1.0
- * @date 13-10-2023
- *
- * Header pour les struct Buffer
- *
- */
-
-#pragma once
-
-#ifndef BUFFER
-#define BUFFER
-
-#include <GL/glew.h>
-#include <GLFW/glfw3.h>
-
-#include "Object.h"
-
-/**
- * @struct Buffer
- */
-typedef struct Buffer
-{
-    GLuint VAO;
-    GLuint VBO;
-    GLuint EBO;
-    Object * object;
-} Buffer;
-
-/**
- * @brief initiate VAO, VBO and EBO
- * 
- * @param obj 
- * @return Buffer* 
- */
-Buffer * Buffer_init(Object * obj);
-
-/**
- * @brief update VAO, VBO and EBO
- * 
- * @param obj
- * @param buffer
- * @return void 
- */
-void Buffer_update(Object * obj, Buffer * buf);
-
-/**
- * @brief 
- * 
- * @param obj 
- * @return void
- */
-void Buffer_bind(const Buffer * buf);
-
-/**
- * @brief 
- * 
- * @param obj 
- * @return void
- */
-void Buffer_draw(const Buffer * buf);
-
+/**
+ * @file Buffer.h
+ * @brief Header for struct Buffer
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 13-10-2023
+ *
+ * Header pour les struct Buffer
+ *
+ */
+
+#pragma once
+
+#ifndef BUFFER
+#define BUFFER
+
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include "Object.h"
+
+/**
+ * @struct Buffer
+ */
+typedef struct Buffer
+{
+    GLuint VAO;
+    GLuint VBO;
+    GLuint EBO;
+    Object * object;
+    GLenum index_type;          //GL_UNSIGNED_SHORT or GL_UNSIGNED_INT, the type of the indices in the EBO
+    bool owns_ebo;              //false when the EBO is the shared one of grid indices
+} Buffer;
+
+/**
+ * @brief initiate VAO, VBO and EBO, the shared EBO of grid indices or its own one
+ * (in 16 bits when the object has at most 65536 vertices)
+ * 
+ * @param obj 
+ * @return Buffer* 
+ */
+Buffer * Buffer_init(Object * obj);
+
+/**
+ * @brief update VAO, VBO and EBO
+ * 
+ * @param obj
+ * @param buffer
+ * @return void 
+ */
+void Buffer_update(Object * obj, Buffer * buf);
+
+/**
+ * @brief upload the vertices [first, first + count[ of the object to the VBO
+ * 
+ * @param buf
+ * @param first index of the first vertex
+ * @param count number of vertices
+ * @return void 
+ */
+void Buffer_updateRange(Buffer * buf, unsigned int first, unsigned int count);
+
+/**
+ * @brief 
+ * 
+ * @param obj 
+ * @return void
+ */
+void Buffer_bind(const Buffer * buf);
+
+/**
+ * @brief 
+ * 
+ * @param obj 
+ * @return void
+ */
+void Buffer_draw(const Buffer * buf);
+
+/**
+ * @brief delete the VAO, the VBO and the EBO (unless it is the shared one of grid indices) and free the buffer,
+ * the object is left to Object_free and may already be freed
+ * 
+ * @param buf 
+ * @return void
+ */
+void Buffer_free(Buffer * buf);
+
 #endif
\ No newline at end of file
@@ -1,477 +1,956 @@
-#include "Curve.h"
-#include <stdio.h>
-#include <stdlib.h>
-#include <pthread.h>
-#include <math.h>
-
-// Function to recursively calculate a point on the Bezier curve
-static Vec3 CalculateBezierPoint(Vec3* control_points, unsigned char num_points, const float t) {
-    if (num_points == 1) {
-        // Base case: Return the single control point
-        return control_points[0];
-    }
-
-    // Create a temporary array to store the intermediate control points
-    Vec3* temp_points = (Vec3*) calloc(num_points, sizeof(Vec3));
-    if (!temp_points) {
-        fprintf(stderr, "Error: Memory allocation failed for temporary points array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    // Calculate the next set of control points
-    for (unsigned short i = 0; i < num_points - 1; i++) {
-        temp_points[i].x = (1.0f - t) * control_points[i].x + t * control_points[i + 1].x;
-        temp_points[i].y = (1.0f - t) * control_points[i].y + t * control_points[i + 1].y;
-        temp_points[i].z = (1.0f - t) * control_points[i].z + t * control_points[i + 1].z;
-    }
-
-    // Recursively calculate the point on the Bezier curve
-    Vec3 result = CalculateBezierPoint(temp_points, num_points - 1, t);
-
-    // Clean up the temporary array
-    free(temp_points);
-
-    return result;
-}
-
-// Function to generate the curve using the Casteljau recursive algorithm
-static void Curve3D_bezier(Curve3D* c, Vec3* c_points, unsigned char k) {
-    if (!c || !c_points) {
-        fprintf(stderr, "Error: Invalid input arguments for Bezier curve generation.\n");
-        return;
-    }
-
-    // Allocate memory for the generated curve data
-    c->data = (float*) calloc(c->npoints * 3, sizeof(float));
-    if (!c->data) {
-        fprintf(stderr, "Error: Memory allocation failed for Bezier curve data.\n");
-        return;
-    }
-
-    // Generate points along the Bezier curve
-    for (unsigned short i = 0; i < c->npoints; i++) {
-        float t = (float)i / (c->npoints - 1);
-        Vec3 point = CalculateBezierPoint(c_points, k, t);
-        c->data[i * 3] = point.x;
-        c->data[i * 3 + 1] = point.y;
-        c->data[i * 3 + 2] = point.z;
-    }
-}
-
-// Function to generate the curve using the Catmull-Rom algorithm for a uniform B-spline
-static void Curve3D_catmullRom(Curve3D* c, Vec3* c_points, unsigned char k) {
-    if (!c || !c_points || k < 4) {
-        fprintf(stderr, "Error: Invalid input arguments for Catmull-Rom curve generation.\n");
-        return;
-    }
-
-    // Allocate memory for the generated curve data
-    c->data = (float*) calloc(c->npoints * 3, sizeof(float));
-    if (!c->data) {
-        fprintf(stderr, "Error: Memory allocation failed for Catmull-Rom curve data.\n");
-        return;
-    }
-
-    // Temporary variables for interpolated points
-    Vec3 p0, p1, p2, p3;
-
-    // Generate points along the Catmull-Rom B-spline
-    for (int i = 0; i < c->npoints; i++) {
-        float t = (float)i / (c->npoints - 1); // Adjusted range to [0, 1]
-        unsigned char segment = (unsigned char)(t * (k - 3)); // Ensure valid range
-        float segmentT = (t * (k - 3)) - (float)segment;
-
-        // Calculate the four control points for the Catmull-Rom B-spline segment
-        p0 = c_points[segment];
-        p1 = c_points[segment + 1];
-        p2 = c_points[segment + 2];
-        p3 = c_points[segment + 3];
-
-        // Interpolate using the Catmull-Rom formula
-        float t2 = segmentT * segmentT;
-        float t3 = t2 * segmentT;
-        float h1 = -0.5f * t3 + t2 - 0.5f * segmentT;
-        float h2 = 1.5f * t3 - 2.5f * t2 + 1.0f;
-        float h3 = -1.5f * t3 + 2.0f * t2 + 0.5f * segmentT;
-        float h4 = 0.5f * t3 - 0.5f * t2;
-
-        Vec3* point = (Vec3*) calloc(1, sizeof(Vec3));
-        if (!point) {
-            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-            exit(EXIT_FAILURE);
-        }
-        point->x = (p0.x * h1 + p1.x * h2 + p2.x * h3 + p3.x * h4);
-        point->y = (p0.y * h1 + p1.y * h2 + p2.y * h3 + p3.y * h4);
-        point->z = (p0.z * h1 + p1.z * h2 + p2.z * h3 + p3.z * h4);
-
-        // Store the interpolated point in the curve data
-        c->data[i * 3] = point->x;
-        c->data[i * 3 + 1] = point->y;
-        c->data[i * 3 + 2] = point->z;
-
-        free(point);
-    }
-}
-
-// Function to generate the curve using the NUBS algorithm
-static void Curve3D_nubs(Curve3D * c, Vec3 * c_points, float * nodals, unsigned char n, unsigned char degree) {
-    
-    unsigned char k = degree + 1;
-
-    // Allocate memory for the generated curve data
-    c->data = (float*) calloc(c->npoints * 3, sizeof(float) );
-    if (!c->data) {
-        fprintf(stderr, "Error: Memory allocation failed for NUBS curve data.\n");
-        return;
-    }
-
-    //calculate the number of nodal vectors
-    unsigned short node_count = (unsigned short) n + k;
-    unsigned short subspline_count = (unsigned short) n - k + 2;
-
-    //domain of definition of t will go from 0 to definition
-    float definition = 0.0f;
-
-    unsigned short i;
-    for (i = 0; i < node_count; i++)
-        definition += nodals[i];
-
-    for (i = 0; i < c->npoints; i++)
-    {
-        // Allocate memory to temporarly store the point to interpolate
-        Vec3 * point = (Vec3 *) calloc(1, sizeof(Vec3));
-        if (!point) {
-            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-            exit(EXIT_FAILURE);
-        }
-
-        point->x = 0.0f;
-        point->y = 0.0f;
-        point->z = 0.0f;
-
-
-
-        // Store the interpolated point in the curve data
-        c->data[i * 3] = point->x;
-        c->data[i * 3 + 1] = point->y;
-        c->data[i * 3 + 2] = point->z;
-
-        //free the temporary point
-        free(point);
-    }
-
-}
-
-
-// Function to initialize a Curve3D
-Curve3D* Curve3D_init(Vec3* control_points, unsigned char n_control_points , const unsigned short n_points, const enum methode mode) {
-    Curve3D* curve = (Curve3D*) calloc(1, sizeof(Curve3D));
-    if (!curve) {
-        fprintf(stderr, "Error: Memory allocation failed for Curve3D.\n");
-        return NULL;
-    }
-
-    curve->npoints = n_points;
-    curve->data = (float*) calloc(n_points * 3, sizeof(float) ); // 3 components (x, y, z) per point
-    if (!curve->data) {
-        fprintf(stderr, "Error: Memory allocation failed for Curve3D data.\n");
-        free(curve);
-        return NULL;
-    }
-
-    // Generate the curve based on the selected method
-    switch (mode) {
-        case BEZIER:
-            Curve3D_bezier(curve, control_points, n_control_points);
-            break;
-        case CATMULL_ROM:
-            Curve3D_catmullRom(curve, control_points, n_control_points);
-            break;
-        case NUBS:
-            //Curve3D_nubs(curve, control_points, n_control_points);
-            break;
-        default:
-            fprintf(stderr, "Error: Invalid method selected for curve generation.\n");
-            free(curve->data);
-            free(curve);
-            return NULL;
-    }
-
-    return curve;
-}
-
-typedef struct thread_args
-{
-    Curve3D * c;
-    unsigned short i;
-    unsigned char n;
-    unsigned char m;
-    Object * o;
-    Vec3 * color; 
-    Vec3 * specular_color; 
-    float shininess; 
-    float reflectivness;
-    float radius;
-} thread_args;
-
-static void * thread_fn_T(void * args)
-{
-    thread_args * th_d = (thread_args *) args;
-    Curve3D * c = th_d->c;
-    unsigned char n = th_d->n;
-    unsigned short i = th_d->i * n + 1;
-
-    for (unsigned char x = 0; x < n; x++)
-    {
-        if (i + x < c->npoints - 1)
-        {
-            c->T[(i + x)].x = (c->data[3 * (i + x) + 0] - c->data[3 * ((i + x)-1) + 0] + c->data[3 * ((i + x)+1) + 0] - c->data[3 * (i + x) + 0]) / 2.0f;
-            c->T[(i + x)].y = (c->data[3 * (i + x) + 1] - c->data[3 * ((i + x)-1) + 1] + c->data[3 * ((i + x)+1) + 1] - c->data[3 * (i + x) + 1]) / 2.0f;
-            c->T[(i + x)].z = (c->data[3 * (i + x) + 2] - c->data[3 * ((i + x)-1) + 2] + c->data[3 * ((i + x)+1) + 2] - c->data[3 * (i + x) + 2]) / 2.0f;
-            Vec3_normalize(&c->T[(i + x)]);
-        }
-    }
-
-    return NULL;
-}
-
-static void calc_T(Curve3D * c)
-{
-    //first point
-    c->T[0].x = c->data[3] - c->data[0];
-    c->T[0].y = c->data[4] - c->data[1];
-    c->T[0].z = c->data[5] - c->data[2];
-    Vec3_normalize(&c->T[0]);
-
-    unsigned char n_round = 1 + (c->npoints - 2) / PTHREAD_THREADS_MAX;
-
-    pthread_t * threads = (pthread_t *) calloc( __min(PTHREAD_THREADS_MAX, c->npoints - 2) , sizeof(pthread_t) );
-    if (!threads) {
-        fprintf(stderr, "Error: Memory allocation failed for threads.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    thread_args * t_args = (thread_args *) calloc( __min(PTHREAD_THREADS_MAX, c->npoints - 2) , sizeof(thread_args));
-    if (!t_args) {
-        fprintf(stderr, "Error: Memory allocation failed for threads arguments.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    for (unsigned short t = 0; t < __min(PTHREAD_THREADS_MAX, c->npoints - 2); t++)
-    {
-        t_args[t].c = c;
-        t_args[t].n = n_round;
-        t_args[t].i = t;
-        pthread_create(&threads[t], NULL, thread_fn_T, (void *) &t_args[t]);
-    }
-
-    //last point
-    c->T[c->npoints - 1].x = c->data[3 * (c->npoints - 1) + 0] - c->data[3 * (c->npoints - 2) + 0];
-    c->T[c->npoints - 1].y = c->data[3 * (c->npoints - 1) + 1] - c->data[3 * (c->npoints - 2) + 1];
-    c->T[c->npoints - 1].z = c->data[3 * (c->npoints - 1) + 2] - c->data[3 * (c->npoints - 2) + 2];
-    Vec3_normalize(&c->T[c->npoints - 1]);
-
-    for (unsigned short t = 0; t < __min(PTHREAD_THREADS_MAX, c->npoints - 2); t++)
-        pthread_join(threads[t], NULL);
-
-    free(t_args);
-    free(threads);
-}
-
-static void calc_N(Curve3D * c)
-{
-    //first point
-    c->N[0].x = c->T[1].x - c->T[0].x;
-    c->N[0].y = c->T[1].y - c->T[0].y;
-    c->N[0].z = c->T[1].z - c->T[0].z;
-    Vec3_normalize(&c->N[0]);
-
-    for (unsigned short i = 1; i < c->npoints - 1; i++)
-    {
-        c->N[i].x = (c->T[i+1].x - c->T[i].x + c->T[i].x - c->T[i-1].x) / 2.0f;
-        c->N[i].y = (c->T[i+1].y - c->T[i].y + c->T[i].y - c->T[i-1].y) / 2.0f;
-        c->N[i].z = (c->T[i+1].z - c->T[i].z + c->T[i].z - c->T[i-1].z) / 2.0f;
-
-        if (Vec3_length2(&c->N[i]) == 0)
-        {
-            c->N[i].x = c->N[i-1].x;
-            c->N[i].y = c->N[i-1].y;
-            c->N[i].z = c->N[i-1].z;
-        }
-        else
-        {
-            Vec3_normalize(&c->N[i]);
-        }
-        
-    }
-
-    //last point
-    c->N[c->npoints-1].x = c->T[c->npoints-1].x - c->T[c->npoints-2].x;
-    c->N[c->npoints-1].y = c->T[c->npoints-1].y - c->T[c->npoints-2].y;
-    c->N[c->npoints-1].z = c->T[c->npoints-1].z - c->T[c->npoints-2].z;
-    Vec3_normalize(&c->N[c->npoints-1]);
-}
-
-void Curve3D_calculateTNB(Curve3D * c)
-{
-    c->T = (Vec3 *) calloc(c->npoints, sizeof(Vec3));
-    if (!c->T) {
-        fprintf(stderr, "Error: Memory allocation failed for Curve3D T.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    calc_T(c);
-
-    c->N = (Vec3 *) calloc(c->npoints, sizeof(Vec3));
-    if (!c->N) {
-        fprintf(stderr, "Error: Memory allocation failed for Curve3D N.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    calc_N(c);
-
-    c->B = (Vec3 *) calloc(c->npoints, sizeof(Vec3));
-    if (!c->B) {
-        fprintf(stderr, "Error: Memory allocation failed for Curve3D B.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    for (unsigned short i = 0; i < c->npoints; i++)
-        c->B[i] = * Vec3_cross(&c->T[i], &c->N[i]);
-
-}
-
-static void * thread_fn_Surface(void * args)
-{
-    unsigned char s = 14;
-
-    thread_args * th_d = (thread_args *) args;
-    Curve3D * c = th_d->c;
-    unsigned char n = th_d->n;
-    unsigned char meridians = th_d->m;
-    unsigned short t = th_d->i * n;
-    Object * surface = th_d->o;
-    Vec3 * color = th_d->color; 
-    Vec3 * specular_color = th_d->specular_color; 
-    float shininess = th_d->shininess; 
-    float reflection = th_d->reflectivness;
-    float radius = th_d->radius;
-
-    for (unsigned short i = t; i < t + n; i++)
-    {
-        if (i < c->npoints)
-            for (unsigned char j = 0; j < meridians; j++)
-            {
-                float angle = 360.0f * ( (float) j ) / ( (float) meridians );
-                Quaternion * rotation = Quaternion_fromAxisAngle(angle, &c->T[i]);
-                Vec3 * v = Quaternion_RotateVector(&c->N[i], rotation);
-                Vec3_normalize(v);
-
-                //POSITION
-                surface->vertexBuffer[s * (i * meridians + j) + 0] = c->data[i*3 + 0] + radius * v->x;
-                surface->vertexBuffer[s * (i * meridians + j) + 1] = c->data[i*3 + 1] + radius * v->y;
-                surface->vertexBuffer[s * (i * meridians + j) + 2] = c->data[i*3 + 2] + radius * v->z;
-
-                //NORMAL
-                surface->vertexBuffer[s * (i * meridians + j) + 3] = v->x;
-                surface->vertexBuffer[s * (i * meridians + j) + 4] = v->y;
-                surface->vertexBuffer[s * (i * meridians + j) + 5] = v->z;
-
-                free(rotation);
-                free(v);
-
-                //COLORS
-                surface->vertexBuffer[s * (i * meridians + j) + 6] = color->x;
-                surface->vertexBuffer[s * (i * meridians + j) + 7] = color->y;
-                surface->vertexBuffer[s * (i * meridians + j) + 8] = color->z;
-
-                surface->vertexBuffer[s * (i * meridians + j) + 9]  = specular_color->x;
-                surface->vertexBuffer[s * (i * meridians + j) + 10] = specular_color->y;
-                surface->vertexBuffer[s * (i * meridians + j) + 11] = specular_color->z;
-
-                surface->vertexBuffer[s * (i * meridians + j) + 12] = shininess;
-                surface->vertexBuffer[s * (i * meridians + j) + 13] = reflection;
-
-                //INDEX
-                if (i < c->npoints - 1)
-                {
-                    surface->indexBuffer[(i * meridians + j) * 6 + 0] = i * meridians + j;
-                    surface->indexBuffer[(i * meridians + j) * 6 + 1] = (i+1) * meridians + j;
-                    surface->indexBuffer[(i * meridians + j) * 6 + 2] = (i+1) * meridians + ( (j+1) % meridians );
-
-                    surface->indexBuffer[(i * meridians + j) * 6 + 3] = i * meridians + j;
-                    surface->indexBuffer[(i * meridians + j) * 6 + 4] = (i+1) * meridians + ( (j+1) % meridians );
-                    surface->indexBuffer[(i * meridians + j) * 6 + 5] = i * meridians + ( (j+1) % meridians );
-                }
-                    
-            }
-    }
-
-    return NULL;
-}
-
-Object * Curve3D_generateSurface(Curve3D * c, unsigned char meridians, Vec3 * color, Vec3 * specular_color, float shininess, float reflection,
- float radius)
-{
-    if (c->T == NULL)
-    {
-        Curve3D_calculateTNB(c);
-    }
-
-    unsigned char * layout = (unsigned char *) calloc(6, sizeof(unsigned char));
-    if (!layout) {
-        fprintf(stderr, "Error: Memory allocation failed for layout.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    layout[0] = 3;
-    layout[1] = 3;
-    layout[2] = 3;
-    layout[3] = 3;
-    layout[4] = 1;
-    layout[5] = 1;
-
-    Object * surface = Object_init( 
-        ( (unsigned int) c->npoints ) * ( (unsigned int) meridians ), 
-        6, layout,
-        ( ( (unsigned int) c->npoints) - 1) * ( (unsigned int) meridians ) * 2
-    );
-
-    unsigned char n_round = 1 + (c->npoints) / PTHREAD_THREADS_MAX;
-
-    pthread_t * threads = (pthread_t *) calloc(__min(PTHREAD_THREADS_MAX, c->npoints), sizeof(pthread_t) );
-    if (!threads) {
-        fprintf(stderr, "Error: Memory allocation failed for threads.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    thread_args * t_args = (thread_args *) calloc(__min(PTHREAD_THREADS_MAX, c->npoints), sizeof(thread_args) );
-    if (!t_args) {
-        fprintf(stderr, "Error: Memory allocation failed for threads arguments.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    for (unsigned short t = 0; t < __min(PTHREAD_THREADS_MAX, c->npoints); t++)
-    {
-        t_args[t].c = c;
-        t_args[t].n = n_round;
-        t_args[t].i = t;
-        t_args[t].m = meridians;
-        t_args[t].o = surface;
-        t_args[t].color = color;
-        t_args[t].radius = radius;
-        t_args[t].reflectivness = reflection;
-        t_args[t].shininess = shininess;
-        t_args[t].specular_color = specular_color;
-
-        pthread_create(&threads[t], NULL, thread_fn_Surface, (void *) &t_args[t]);
-    }
-
-    for (unsigned short t = 0; t < __min(PTHREAD_THREADS_MAX, c->npoints - 2); t++)
-        pthread_join(threads[t], NULL);
-
-    free(threads);
-    free(t_args);
-    return surface;
-
+#include "Curve.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "ThreadPool.h"
+#include "VertexFormat.hpp"
+#include <math.h>
+#include <string.h>
+
+// Function to recursively calculate a point on the Bezier curve
+static Vec3 CalculateBezierPoint(Vec3* control_points, unsigned int num_points, const float t) {
+    if (num_points == 1) {
+        // Base case: Return the single control point
+        return control_points[0];
+    }
+
+    // Create a temporary array to store the intermediate control points
+    Vec3* temp_points = (Vec3*) calloc(num_points, sizeof(Vec3));
+    if (!temp_points) {
+        fprintf(stderr, "Error: Memory allocation failed for temporary points array.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Calculate the next set of control points
+    for (unsigned int i = 0; i < num_points - 1; i++) {
+        temp_points[i].x = (1.0f - t) * control_points[i].x + t * control_points[i + 1].x;
+        temp_points[i].y = (1.0f - t) * control_points[i].y + t * control_points[i + 1].y;
+        temp_points[i].z = (1.0f - t) * control_points[i].z + t * control_points[i + 1].z;
+    }
+
+    // Recursively calculate the point on the Bezier curve
+    Vec3 result = CalculateBezierPoint(temp_points, num_points - 1, t);
+
+    // Clean up the temporary array
+    free(temp_points);
+
+    return result;
+}
+
+// Parameter of the sample i of a curve evaluated on n_total points
+static float sample_t(unsigned int i, unsigned int n_total) {
+    return (n_total > 1) ? (float)i / (float)(n_total - 1) : 0.0f;
+}
+
+// Function to generate the curve using the Casteljau recursive algorithm
+// c->npoints samples are evaluated starting at sample "first" of a curve of n_total samples
+static void Curve3D_bezier(Curve3D* c, Vec3* c_points, unsigned int k, unsigned int n_total, unsigned int first) {
+    if (!c || !c->data || !c_points) {
+        fprintf(stderr, "Error: Invalid input arguments for Bezier curve generation.\n");
+        return;
+    }
+
+    // Generate points along the Bezier curve
+    for (unsigned int i = 0; i < c->npoints; i++) {
+        float t = sample_t(first + i, n_total);
+        Vec3 point = CalculateBezierPoint(c_points, k, t);
+        c->data[i * 3] = point.x;
+        c->data[i * 3 + 1] = point.y;
+        c->data[i * 3 + 2] = point.z;
+    }
+}
+
+// Function to generate the curve using the Catmull-Rom algorithm for a uniform B-spline
+// c->npoints samples are evaluated starting at sample "first" of a curve of n_total samples
+static void Curve3D_catmullRom(Curve3D* c, Vec3* c_points, unsigned int k, unsigned int n_total, unsigned int first) {
+    if (!c || !c->data || !c_points || k < 4) {
+        fprintf(stderr, "Error: Invalid input arguments for Catmull-Rom curve generation.\n");
+        return;
+    }
+
+    // Temporary variables for interpolated points
+    Vec3 p0, p1, p2, p3;
+
+    // Generate points along the Catmull-Rom B-spline
+    for (unsigned int i = 0; i < c->npoints; i++) {
+        float t = sample_t(first + i, n_total); // Adjusted range to [0, 1]
+        unsigned int segment = (unsigned int)(t * (k - 3));
+        float segmentT = (t * (k - 3)) - (float)segment;
+
+        // t = 1 is the end of the last segment
+        if (segment > k - 4) {
+            segment = k - 4;
+            segmentT = 1.0f;
+        }
+
+        // Calculate the four control points for the Catmull-Rom B-spline segment
+        p0 = c_points[segment];
+        p1 = c_points[segment + 1];
+        p2 = c_points[segment + 2];
+        p3 = c_points[segment + 3];
+
+        // Interpolate using the Catmull-Rom formula
+        float t2 = segmentT * segmentT;
+        float t3 = t2 * segmentT;
+        float h1 = -0.5f * t3 + t2 - 0.5f * segmentT;
+        float h2 = 1.5f * t3 - 2.5f * t2 + 1.0f;
+        float h3 = -1.5f * t3 + 2.0f * t2 + 0.5f * segmentT;
+        float h4 = 0.5f * t3 - 0.5f * t2;
+
+        // Store the interpolated point in the curve data
+        c->data[i * 3]     = (p0.x * h1 + p1.x * h2 + p2.x * h3 + p3.x * h4);
+        c->data[i * 3 + 1] = (p0.y * h1 + p1.y * h2 + p2.y * h3 + p3.y * h4);
+        c->data[i * 3 + 2] = (p0.z * h1 + p1.z * h2 + p2.z * h3 + p3.z * h4);
+    }
+}
+
+// Function to generate the curve using the NUBS algorithm
+static void Curve3D_nubs(Curve3D * c, Vec3 * c_points, float * nodals, unsigned int n, unsigned int degree) {
+    
+    unsigned int k = degree + 1;
+
+    // Allocate memory for the generated curve data
+    c->data = (float*) calloc(c->npoints * 3, sizeof(float) );
+    if (!c->data) {
+        fprintf(stderr, "Error: Memory allocation failed for NUBS curve data.\n");
+        return;
+    }
+
+    //calculate the number of nodal vectors
+    unsigned int node_count = n + k;
+    unsigned int subspline_count = n - k + 2;
+
+    //domain of definition of t will go from 0 to definition
+    float definition = 0.0f;
+
+    unsigned int i;
+    for (i = 0; i < node_count; i++)
+        definition += nodals[i];
+
+    for (i = 0; i < c->npoints; i++)
+    {
+        // Allocate memory to temporarly store the point to interpolate
+        Vec3 * point = (Vec3 *) calloc(1, sizeof(Vec3));
+        if (!point) {
+            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        point->x = 0.0f;
+        point->y = 0.0f;
+        point->z = 0.0f;
+
+
+
+        // Store the interpolated point in the curve data
+        c->data[i * 3] = point->x;
+        c->data[i * 3 + 1] = point->y;
+        c->data[i * 3 + 2] = point->z;
+
+        //free the temporary point
+        free(point);
+    }
+
+}
+
+// Evaluate c->npoints samples, starting at "first", of a curve of n_total samples, return 0 if the method is invalid
+static unsigned char Curve3D_evaluate(Curve3D * c, Vec3 * control_points, unsigned int n_control_points, unsigned int n_total, unsigned int first, const enum methode mode) {
+    switch (mode) {
+        case BEZIER:
+            Curve3D_bezier(c, control_points, n_control_points, n_total, first);
+            return 1;
+        case CATMULL_ROM:
+            Curve3D_catmullRom(c, control_points, n_control_points, n_total, first);
+            return 1;
+        case NUBS:
+            //Curve3D_nubs(c, control_points, n_control_points);
+            return 1;
+        default:
+            return 0;
+    }
+}
+
+// Function to initialize a Curve3D
+Curve3D* Curve3D_init(Vec3* control_points, unsigned int n_control_points , const unsigned int n_points, const enum methode mode) {
+    Arena * arena = Arena_current();
+    Curve3D* curve = (Curve3D*) Arena_alloc(arena, 1, sizeof(Curve3D));
+    curve->arena = arena;
+
+    curve->npoints = n_points;
+    curve->data = (float*) Arena_alloc(arena, (size_t) n_points * 3, sizeof(float) ); // 3 components (x, y, z) per point
+
+    // Generate the curve based on the selected method
+    if (!Curve3D_evaluate(curve, control_points, n_control_points, n_points, 0, mode)) {
+        fprintf(stderr, "Error: Invalid method selected for curve generation.\n");
+        Curve3D_free(curve);
+        return NULL;
+    }
+
+    //keep the control points to allow local updates
+    curve->n_controls = n_control_points;
+    curve->mode = mode;
+    curve->controls = (Vec3 *) Arena_alloc(arena, n_control_points, sizeof(Vec3));
+    for (unsigned int i = 0; i < n_control_points; i++)
+        curve->controls[i] = control_points[i];
+
+    Curve3D_calculateArcLength(curve);
+
+    return curve;
+}
+
+typedef struct basis_entry
+{
+    unsigned int k;
+    unsigned int n;
+    enum methode mode;
+    unsigned char derivative;
+    Matrix * B;
+    struct basis_entry * next;
+} basis_entry;
+
+static basis_entry * basis_cache = NULL;
+static pthread_mutex_t basis_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static Matrix * basis_generate(unsigned int k, unsigned int n, const enum methode mode, const unsigned char derivative)
+{
+    Matrix * B = Matrix_generate((unsigned short) k, (unsigned short) n);
+    if (!B) {
+        fprintf(stderr, "Error: Memory allocation failed for basis matrix.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        float t = sample_t(i, n);
+        float * row = B->data + (size_t) i * k;
+
+        if (mode == BEZIER && !derivative)
+        {
+            //Bernstein polynomials, same weights as the Casteljau algorithm
+            double binomial = 1.0;
+            for (unsigned int u = 0; u < k; u++)
+            {
+                row[u] = (float) (binomial * pow(t, (double) u) * pow(1.0 - t, (double) (k - 1 - u)));
+                binomial = binomial * (double) (k - 1 - u) / (double) (u + 1);
+            }
+        }
+        else if (mode == BEZIER && k > 1)
+        {
+            //B'(u, d) = d * (B(u-1, d-1) - B(u, d-1)) with d = k - 1
+            unsigned int d = k - 1;
+            double binomial = 1.0;
+            for (unsigned int u = 0; u < d; u++)
+            {
+                float b = (float) (d * binomial * pow(t, (double) u) * pow(1.0 - t, (double) (d - 1 - u)));
+                row[u] -= b;
+                row[u + 1] += b;
+                binomial = binomial * (double) (d - 1 - u) / (double) (u + 1);
+            }
+        }
+        else if (mode == CATMULL_ROM)
+        {
+            unsigned int segment = (unsigned int)(t * (k - 3));
+            float segmentT = (t * (k - 3)) - (float)segment;
+
+            if (segment > k - 4) {
+                segment = k - 4;
+                segmentT = 1.0f;
+            }
+
+            float t2 = segmentT * segmentT;
+            float t3 = t2 * segmentT;
+
+            if (!derivative)
+            {
+                row[segment + 0] = -0.5f * t3 + t2 - 0.5f * segmentT;
+                row[segment + 1] = 1.5f * t3 - 2.5f * t2 + 1.0f;
+                row[segment + 2] = -1.5f * t3 + 2.0f * t2 + 0.5f * segmentT;
+                row[segment + 3] = 0.5f * t3 - 0.5f * t2;
+            }
+            else
+            {
+                //d/dt = d/dsegmentT * (k - 3)
+                float scale = (float) (k - 3);
+                row[segment + 0] = scale * (-1.5f * t2 + 2.0f * segmentT - 0.5f);
+                row[segment + 1] = scale * (4.5f * t2 - 5.0f * segmentT);
+                row[segment + 2] = scale * (-4.5f * t2 + 4.0f * segmentT + 0.5f);
+                row[segment + 3] = scale * (1.5f * t2 - segmentT);
+            }
+        }
+        //NUBS is not implemented yet, the points stay at the origin like Curve3D_init
+    }
+
+    return B;
+}
+
+Matrix * Curve3D_basisMatrix(unsigned int n_control_points, unsigned int n_points, const enum methode mode, const unsigned char derivative)
+{
+    if (n_control_points == 0 || n_points == 0 || n_control_points > 65535 || n_points > 65535
+        || (mode == CATMULL_ROM && n_control_points < 4)) {
+        fprintf(stderr, "Error: Invalid input arguments for basis matrix.\n");
+        return NULL;
+    }
+
+    pthread_mutex_lock(&basis_lock);
+
+    basis_entry * e = basis_cache;
+    while (e && !(e->k == n_control_points && e->n == n_points && e->mode == mode && e->derivative == derivative))
+        e = e->next;
+
+    if (!e)
+    {
+        e = (basis_entry *) calloc(1, sizeof(basis_entry));
+        if (!e) {
+            fprintf(stderr, "Error: Memory allocation failed for basis cache.\n");
+            exit(EXIT_FAILURE);
+        }
+        e->k = n_control_points;
+        e->n = n_points;
+        e->mode = mode;
+        e->derivative = derivative;
+        e->B = basis_generate(n_control_points, n_points, mode, derivative);
+        e->next = basis_cache;
+        basis_cache = e;
+    }
+
+    pthread_mutex_unlock(&basis_lock);
+    return e->B;
+}
+
+static void calc_arc_lut(Curve3D * c)
+{
+    //uniform lookup: arc_lut[k] is the last point before the distance k * length / (npoints - 1)
+    if (c->npoints < 2)
+        return;
+
+    unsigned int i = 0;
+    for (unsigned int k = 0; k < c->npoints; k++)
+    {
+        float s = c->length * (float) k / (float) (c->npoints - 1);
+        while (i < c->npoints - 2 && c->arclength[i + 1] <= s)
+            i++;
+        c->arc_lut[k] = i;
+    }
+}
+
+void Curve3D_calculateArcLength(Curve3D * c)
+{
+    if (c->npoints == 0) {
+        c->length = 0.0f;
+        return;
+    }
+
+    if (!c->arclength)
+        c->arclength = (float *) Arena_alloc(c->arena, c->npoints, sizeof(float));
+    if (!c->arc_lut)
+        c->arc_lut = (unsigned int *) Arena_alloc(c->arena, c->npoints, sizeof(unsigned int));
+
+    //cumulative chord length
+    double sum = 0.0;
+    c->arclength[0] = 0.0f;
+    for (unsigned int i = 1; i < c->npoints; i++)
+    {
+        float dx = c->data[3 * i + 0] - c->data[3 * (i-1) + 0];
+        float dy = c->data[3 * i + 1] - c->data[3 * (i-1) + 1];
+        float dz = c->data[3 * i + 2] - c->data[3 * (i-1) + 2];
+        sum += sqrtf(dx * dx + dy * dy + dz * dz);
+        c->arclength[i] = (float) sum;
+    }
+    c->length = (float) sum;
+
+    calc_arc_lut(c);
+}
+
+// segment [i, i+1] containing the distance s, and the position of s in it
+static unsigned int arc_locate(Curve3D * c, float s, float * frac)
+{
+    if (c->npoints < 2 || c->length <= 0.0f) {
+        *frac = 0.0f;
+        return 0;
+    }
+
+    if (s <= 0.0f)
+        s = 0.0f;
+    if (s >= c->length)
+        s = c->length;
+
+    //uniform lookup : the cell k holds the segments arc_lut[k] to arc_lut[k + 1], searched by halves
+    //so a cell covering many short segments costs a log of their number, not a walk over them
+    unsigned int cell = (unsigned int) (s / c->length * (float) (c->npoints - 1));
+    if (cell > c->npoints - 2)
+        cell = c->npoints - 2;
+
+    unsigned int i = c->arc_lut[cell];
+    unsigned int hi = c->arc_lut[cell + 1];
+    while (i < hi)
+    {
+        unsigned int mid = (i + hi) / 2;
+        if (c->arclength[mid + 1] < s)
+            i = mid + 1;
+        else
+            hi = mid;
+    }
+
+    //newton step on the chord, s is linear in t on a segment so it lands exactly
+    float ds = c->arclength[i + 1] - c->arclength[i];
+    *frac = (ds > 0.0f) ? (s - c->arclength[i]) / ds : 0.0f;
+    if (*frac < 0.0f)
+        *frac = 0.0f;
+    if (*frac > 1.0f)
+        *frac = 1.0f;
+
+    return i;
+}
+
+float Curve3D_parameterAtDistance(Curve3D * c, float s)
+{
+    float frac;
+    unsigned int i = arc_locate(c, s, &frac);
+
+    if (c->npoints < 2)
+        return 0.0f;
+
+    return ((float) i + frac) / (float) (c->npoints - 1);
+}
+
+Vec3 Curve3D_pointAtDistance(Curve3D * c, float s)
+{
+    float frac;
+    unsigned int i = arc_locate(c, s, &frac);
+    unsigned int j = (i + 1 < c->npoints) ? i + 1 : i;
+
+    Vec3 p;
+    p.x = c->data[3 * i + 0] + frac * (c->data[3 * j + 0] - c->data[3 * i + 0]);
+    p.y = c->data[3 * i + 1] + frac * (c->data[3 * j + 1] - c->data[3 * i + 1]);
+    p.z = c->data[3 * i + 2] + frac * (c->data[3 * j + 2] - c->data[3 * i + 2]);
+    return p;
+}
+
+typedef struct distance_args
+{
+    Curve3D * c;
+    const float * distances;
+    Vec3 * points;
+} distance_args;
+
+static void thread_fn_distances(unsigned int begin, unsigned int end, void * args)
+{
+    distance_args * d = (distance_args *) args;
+
+    for (unsigned int i = begin; i < end; i++)
+        d->points[i] = Curve3D_pointAtDistance(d->c, d->distances[i]);
+}
+
+void Curve3D_pointsAtDistances(Curve3D * c, const float * distances, unsigned int count, Vec3 * points)
+{
+    distance_args d_args;
+    d_args.c = c;
+    d_args.distances = distances;
+    d_args.points = points;
+
+    ThreadPool_parallelFor(0, count, 4096, thread_fn_distances, (void *) &d_args);
+}
+
+typedef struct resample_args
+{
+    Curve3D * c;
+    float * dest;
+    unsigned int n;
+} resample_args;
+
+static void thread_fn_resample(unsigned int begin, unsigned int end, void * args)
+{
+    resample_args * r = (resample_args *) args;
+    Curve3D * c = r->c;
+    float * dest = r->dest;
+    unsigned int n = r->n;
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        float s = (n > 1) ? c->length * (float) i / (float) (n - 1) : 0.0f;
+        Vec3 p = Curve3D_pointAtDistance(c, s);
+        dest[3 * i + 0] = p.x;
+        dest[3 * i + 1] = p.y;
+        dest[3 * i + 2] = p.z;
+    }
+}
+
+Curve3D * Curve3D_resampleUniform(Curve3D * c, unsigned int n)
+{
+    Arena * arena = Arena_current();
+    Curve3D * curve = (Curve3D *) Arena_alloc(arena, 1, sizeof(Curve3D));
+    curve->arena = arena;
+
+    curve->npoints = n;
+    curve->data = (float *) Arena_alloc(arena, (size_t) n * 3, sizeof(float));
+
+    if (!c->arclength)
+        Curve3D_calculateArcLength(c);
+
+    resample_args r_args;
+    r_args.c = c;
+    r_args.dest = curve->data;
+    r_args.n = n;
+
+    ThreadPool_parallelFor(0, n, 4096, thread_fn_resample, (void *) &r_args);
+
+    Curve3D_calculateArcLength(curve);
+
+    return curve;
+}
+
+typedef struct thread_args
+{
+    Curve3D * c;
+    unsigned short m;
+    Object * o;
+    StandardVertexFormat::Vertex material;     //color, specular, shininess and reflection of every vertex of a tube
+    float radius;
+} thread_args;
+
+static void thread_fn_T(unsigned int begin, unsigned int end, void * args)
+{
+    thread_args * th_d = (thread_args *) args;
+    Curve3D * c = th_d->c;
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        c->T[i].x = (c->data[3 * i + 0] - c->data[3 * (i-1) + 0] + c->data[3 * (i+1) + 0] - c->data[3 * i + 0]) / 2.0f;
+        c->T[i].y = (c->data[3 * i + 1] - c->data[3 * (i-1) + 1] + c->data[3 * (i+1) + 1] - c->data[3 * i + 1]) / 2.0f;
+        c->T[i].z = (c->data[3 * i + 2] - c->data[3 * (i-1) + 2] + c->data[3 * (i+1) + 2] - c->data[3 * i + 2]) / 2.0f;
+        Vec3_normalize(&c->T[i]);
+    }
+}
+
+// T on the samples [begin, end[
+static void calc_T_range(Curve3D * c, unsigned int begin, unsigned int end)
+{
+    //first point
+    if (begin == 0)
+    {
+        c->T[0].x = c->data[3] - c->data[0];
+        c->T[0].y = c->data[4] - c->data[1];
+        c->T[0].z = c->data[5] - c->data[2];
+        Vec3_normalize(&c->T[0]);
+        begin = 1;
+    }
+
+    //last point
+    if (end == c->npoints)
+    {
+        c->T[c->npoints - 1].x = c->data[3 * (c->npoints - 1) + 0] - c->data[3 * (c->npoints - 2) + 0];
+        c->T[c->npoints - 1].y = c->data[3 * (c->npoints - 1) + 1] - c->data[3 * (c->npoints - 2) + 1];
+        c->T[c->npoints - 1].z = c->data[3 * (c->npoints - 1) + 2] - c->data[3 * (c->npoints - 2) + 2];
+        Vec3_normalize(&c->T[c->npoints - 1]);
+        end = c->npoints - 1;
+    }
+
+    //inner points
+    thread_args t_args;
+    t_args.c = c;
+    ThreadPool_parallelFor(begin, end, 4096, thread_fn_T, (void *) &t_args);
+}
+
+static void calc_T(Curve3D * c)
+{
+    calc_T_range(c, 0, c->npoints);
+}
+
+// N on the samples [begin, end[, a sample with no curvature keeps the previous normal
+static void calc_N_range(Curve3D * c, unsigned int begin, unsigned int end)
+{
+    for (unsigned int i = begin; i < end; i++)
+    {
+        //first point
+        if (i == 0)
+        {
+            c->N[0].x = c->T[1].x - c->T[0].x;
+            c->N[0].y = c->T[1].y - c->T[0].y;
+            c->N[0].z = c->T[1].z - c->T[0].z;
+            Vec3_normalize(&c->N[0]);
+            continue;
+        }
+
+        //last point
+        if (i == c->npoints - 1)
+        {
+            c->N[i].x = c->T[i].x - c->T[i-1].x;
+            c->N[i].y = c->T[i].y - c->T[i-1].y;
+            c->N[i].z = c->T[i].z - c->T[i-1].z;
+            Vec3_normalize(&c->N[i]);
+            continue;
+        }
+
+        c->N[i].x = (c->T[i+1].x - c->T[i].x + c->T[i].x - c->T[i-1].x) / 2.0f;
+        c->N[i].y = (c->T[i+1].y - c->T[i].y + c->T[i].y - c->T[i-1].y) / 2.0f;
+        c->N[i].z = (c->T[i+1].z - c->T[i].z + c->T[i].z - c->T[i-1].z) / 2.0f;
+
+        if (Vec3_length2(&c->N[i]) == 0)
+        {
+            c->N[i].x = c->N[i-1].x;
+            c->N[i].y = c->N[i-1].y;
+            c->N[i].z = c->N[i-1].z;
+        }
+        else
+        {
+            Vec3_normalize(&c->N[i]);
+        }
+    }
+}
+
+static void calc_N(Curve3D * c)
+{
+    calc_N_range(c, 0, c->npoints);
+}
+
+// B = T x N on the samples [begin, end[
+static void calc_B_range(Curve3D * c, unsigned int begin, unsigned int end)
+{
+    for (unsigned int i = begin; i < end; i++)
+    {
+        c->B[i].x = c->T[i].y * c->N[i].z - c->T[i].z * c->N[i].y;
+        c->B[i].y = c->T[i].z * c->N[i].x - c->T[i].x * c->N[i].z;
+        c->B[i].z = c->T[i].x * c->N[i].y - c->T[i].y * c->N[i].x;
+    }
+}
+
+void Curve3D_calculateTNB(Curve3D * c)
+{
+    if (!c->T)
+        c->T = (Vec3 *) Arena_alloc(c->arena, c->npoints, sizeof(Vec3));
+
+    calc_T(c);
+
+    if (!c->N)
+        c->N = (Vec3 *) Arena_alloc(c->arena, c->npoints, sizeof(Vec3));
+
+    calc_N(c);
+
+    if (!c->B)
+        c->B = (Vec3 *) Arena_alloc(c->arena, c->npoints, sizeof(Vec3));
+
+    calc_B_range(c, 0, c->npoints);
+}
+
+// samples of a curve of n samples that can depend on the control point idx
+static Curve3DRange control_support(Curve3D * c, unsigned int idx)
+{
+    Curve3DRange r;
+    r.begin = 0;
+    r.end = c->npoints;
+
+    //a Catmull-Rom segment s uses the control points s to s+3
+    if (c->mode == CATMULL_ROM && c->n_controls >= 4 && c->npoints > 1)
+    {
+        unsigned int n_segments = c->n_controls - 3;
+        unsigned int seg_begin = (idx > 3) ? idx - 3 : 0;
+        unsigned int seg_end = (idx + 1 < n_segments) ? idx + 1 : n_segments;
+
+        //one extra sample on each side against the rounding of t
+        double scale = (double) (c->npoints - 1) / (double) n_segments;
+        double first = floor(seg_begin * scale) - 1.0;
+        double last = ceil(seg_end * scale) + 2.0;
+
+        r.begin = (first > 0.0) ? (unsigned int) first : 0;
+        r.end = (last < (double) c->npoints) ? (unsigned int) last : c->npoints;
+    }
+
+    return r;
+}
+
+Curve3DRange Curve3D_updateControlPoint(Curve3D * c, unsigned int idx, const Vec3 * p)
+{
+    Curve3DRange dirty;
+    dirty.begin = 0;
+    dirty.end = 0;
+
+    if (!c || !c->controls || idx >= c->n_controls) {
+        fprintf(stderr, "Error: Invalid control point for curve update.\n");
+        return dirty;
+    }
+
+    c->controls[idx] = *p;
+
+    //re-evaluate the positions in place
+    Curve3DRange r = control_support(c, idx);
+
+    Curve3D window;
+    memset(&window, 0, sizeof(window));
+    window.data = c->data + 3 * r.begin;
+    window.npoints = r.end - r.begin;
+    Curve3D_evaluate(&window, c->controls, c->n_controls, c->npoints, r.begin, c->mode);
+
+    dirty = r;
+
+    //arc length: new chords in the range, the rest of the table is shifted
+    if (c->arclength && c->npoints > 1)
+    {
+        unsigned int a = (r.begin > 0) ? r.begin : 1;
+        float before = c->arclength[r.end - 1];
+
+        for (unsigned int i = a; i < r.end; i++)
+        {
+            float dx = c->data[3 * i + 0] - c->data[3 * (i-1) + 0];
+            float dy = c->data[3 * i + 1] - c->data[3 * (i-1) + 1];
+            float dz = c->data[3 * i + 2] - c->data[3 * (i-1) + 2];
+            c->arclength[i] = c->arclength[i-1] + sqrtf(dx * dx + dy * dy + dz * dz);
+        }
+
+        float delta = c->arclength[r.end - 1] - before;
+        for (unsigned int i = r.end; i < c->npoints; i++)
+            c->arclength[i] += delta;
+
+        c->length = c->arclength[c->npoints - 1];
+        calc_arc_lut(c);
+    }
+
+    if (!c->T || c->npoints < 2)
+        return dirty;
+
+    //T depends on the neighbours of a point, N on the T of its neighbours
+    unsigned int t_begin = (r.begin > 1) ? r.begin - 1 : 0;
+    unsigned int t_end = (r.end + 1 < c->npoints) ? r.end + 1 : c->npoints;
+    unsigned int n_begin = (r.begin > 2) ? r.begin - 2 : 0;
+    unsigned int n_end = (r.end + 2 < c->npoints) ? r.end + 2 : c->npoints;
+
+    calc_T_range(c, t_begin, t_end);
+    calc_N_range(c, n_begin, n_end);
+
+    //straight samples after the range copy the previous normal, propagate while it is the case
+    while (n_end < c->npoints - 1)
+    {
+        Vec3 d;
+        d.x = (c->T[n_end+1].x - c->T[n_end-1].x) / 2.0f;
+        d.y = (c->T[n_end+1].y - c->T[n_end-1].y) / 2.0f;
+        d.z = (c->T[n_end+1].z - c->T[n_end-1].z) / 2.0f;
+
+        if (Vec3_length2(&d) != 0)
+            break;
+
+        c->N[n_end] = c->N[n_end - 1];
+        n_end++;
+    }
+
+    calc_B_range(c, n_begin, n_end);
+
+    dirty.begin = n_begin;
+    dirty.end = n_end;
+    return dirty;
+}
+
+// T needs one neighbour on each side and N needs the T of its neighbours
+#define CHUNK_HALO 2
+
+void Curve3D_generateChunked(Vec3 * control_points, unsigned int n_control_points, const unsigned int n_points, const enum methode mode,
+ const unsigned int chunk_size, Curve3D_chunkFn fn, void * args)
+{
+    if (n_points < 2 || chunk_size == 0 || !fn) {
+        fprintf(stderr, "Error: Invalid input arguments for chunked curve generation.\n");
+        return;
+    }
+
+    //one window of samples reused by every chunk, with the halo needed for the frames
+    unsigned int capacity = chunk_size + 2 * CHUNK_HALO;
+
+    Curve3D window;
+    memset(&window, 0, sizeof(window));
+    window.data = (float *) calloc((size_t) capacity * 3, sizeof(float));
+    window.T = (Vec3 *) calloc(capacity, sizeof(Vec3));
+    window.N = (Vec3 *) calloc(capacity, sizeof(Vec3));
+    window.B = (Vec3 *) calloc(capacity, sizeof(Vec3));
+    if (!window.data || !window.T || !window.N || !window.B) {
+        fprintf(stderr, "Error: Memory allocation failed for Curve3D chunk.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    //normal of the last sample of the previous chunk, used when a sample has no curvature
+    Vec3 carry = {0.0f, 0.0f, 0.0f};
+
+    for (unsigned int first = 0; first < n_points; first += chunk_size)
+    {
+        unsigned int count = (n_points - first < chunk_size) ? n_points - first : chunk_size;
+        unsigned int w_begin = (first > CHUNK_HALO) ? first - CHUNK_HALO : 0;
+        unsigned int w_end = (n_points - (first + count) > CHUNK_HALO) ? first + count + CHUNK_HALO : n_points;
+        unsigned int h = first - w_begin;
+
+        window.npoints = w_end - w_begin;
+
+        if (!Curve3D_evaluate(&window, control_points, n_control_points, n_points, w_begin, mode)) {
+            fprintf(stderr, "Error: Invalid method selected for curve generation.\n");
+            break;
+        }
+
+        calc_T(&window);
+
+        if (h > 0)
+            window.N[h - 1] = carry;
+
+        calc_N_range(&window, h, h + count);
+        calc_B_range(&window, h, h + count);
+        carry = window.N[h + count - 1];
+
+        Curve3DChunk chunk;
+        chunk.data = window.data + 3 * h;
+        chunk.T = window.T + h;
+        chunk.N = window.N + h;
+        chunk.B = window.B + h;
+        chunk.first = first;
+        chunk.npoints = count;
+
+        fn(&chunk, args);
+    }
+
+    free(window.data);
+    free(window.T);
+    free(window.N);
+    free(window.B);
+}
+
+// position and normal of the vertices of the ring of the sample i, in standard or compact vertices
+template <typename Format>
+static void surface_ring(thread_args * th_d, unsigned int i)
+{
+    Curve3D * c = th_d->c;
+    unsigned short meridians = th_d->m;
+    float radius = th_d->radius;
+    typename Format::Vertex * ring = Format::vertices(th_d->o) + (size_t) i * meridians;
+
+    for (unsigned short j = 0; j < meridians; j++)
+    {
+        float angle = 360.0f * ( (float) j ) / ( (float) meridians );
+        Quaternion * rotation = Quaternion_fromAxisAngle(angle, &c->T[i]);
+        Vec3 * v = Quaternion_RotateVector(&c->N[i], rotation);
+        Vec3_normalize(v);
+
+        ring[j].template set<0>(c->data[i*3 + 0] + radius * v->x, c->data[i*3 + 1] + radius * v->y, c->data[i*3 + 2] + radius * v->z);
+        ring[j].template set<1>(v->x, v->y, v->z);
+
+        free(rotation);
+        free(v);
+    }
+}
+
+static void thread_fn_Surface(unsigned int begin, unsigned int end, void * args)
+{
+    thread_args * th_d = (thread_args *) args;
+    StandardVertexFormat::Vertex * vertices = StandardVertexFormat::vertices(th_d->o);
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        //material first, the ring then sets the position and the normal
+        for (unsigned short j = 0; j < th_d->m; j++)
+            vertices[(size_t) i * th_d->m + j] = th_d->material;
+
+        surface_ring<StandardVertexFormat>(th_d, i);
+    }
+}
+
+template <typename Format>
+static void thread_fn_SurfaceRings(unsigned int begin, unsigned int end, void * args)
+{
+    for (unsigned int i = begin; i < end; i++)
+        surface_ring<Format>((thread_args *) args, i);
+}
+
+// box of the samples [begin, end[ grown by the radius of the rings, instead of reading the vertices back
+static void tube_box(Curve3D * c, unsigned int begin, unsigned int end, float radius, float * min, float * max)
+{
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        min[k] = INFINITY;
+        max[k] = -INFINITY;
+    }
+
+    for (unsigned int i = begin; i < end; i++)
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            min[k] = fminf(min[k], c->data[3 * i + k] - fabsf(radius));
+            max[k] = fmaxf(max[k], c->data[3 * i + k] + fabsf(radius));
+        }
+}
+
+static void tube_bounds(Curve3D * c, Object * surface, float radius)
+{
+    float min[3], max[3];
+    tube_box(c, 0, c->npoints, radius, min, max);
+
+    if (c->npoints > 0)
+        Object_setBounds(surface, min, max, 0.0f);
+}
+
+Object * Curve3D_generateSurface(Curve3D * c, unsigned short meridians, Vec3 * color, Vec3 * specular_color, float shininess, float reflection,
+ float radius)
+{
+    if (c->T == NULL)
+    {
+        Curve3D_calculateTNB(c);
+    }
+
+    //les anneaux se referment : colonnes liées, triangles partagés entre tubes de même résolution
+    Object * surface = StandardVertexFormat::initGrid( 
+        ( (unsigned int) c->npoints ) * ( (unsigned int) meridians ), 
+        Object_gridIndices(c->npoints, meridians, GRID_WRAP_COLS, 0)
+    );
+
+    thread_args t_args;
+    t_args.c = c;
+    t_args.m = meridians;
+    t_args.o = surface;
+    t_args.material = StandardVertex_material(color, specular_color, shininess, reflection);
+    t_args.radius = radius;
+
+    ThreadPool_parallelFor(0, c->npoints, 16, thread_fn_Surface, (void *) &t_args);
+    tube_bounds(c, surface, radius);
+
+    return surface;
+
+}
+
+Curve3DRange Curve3D_updateSurface(Curve3D * c, Object * surface, Curve3DRange range, float radius)
+{
+    Curve3DRange vertices;
+    vertices.begin = 0;
+    vertices.end = 0;
+
+    if (!c || !surface || !c->T || c->npoints == 0 || range.end <= range.begin)
+        return vertices;
+
+    if (surface->types) {
+        fprintf(stderr, "Error: A quantized object can not be updated.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    thread_args t_args;
+    t_args.c = c;
+    t_args.m = (unsigned short) (surface->n_points / c->npoints);
+    t_args.o = surface;
+    t_args.radius = radius;
+
+    if (CompactVertexFormat::matches(surface))
+        ThreadPool_parallelFor(range.begin, range.end, 16, thread_fn_SurfaceRings<CompactVertexFormat>, (void *) &t_args);
+    else
+        ThreadPool_parallelFor(range.begin, range.end, 16, thread_fn_SurfaceRings<StandardVertexFormat>, (void *) &t_args);
+
+    //only the moved rings are read, the bounds grow to hold them
+    float min[3], max[3];
+    tube_box(c, range.begin, range.end, radius, min, max);
+    Object_growBounds(surface, min, max);
+
+    vertices.begin = range.begin * t_args.m;
+    vertices.end = range.end * t_args.m;
+    return vertices;
+}
+
+void Curve3D_free(Curve3D * c)
+{
+    if (!c)
+        return;
+
+    Arena_release(c->arena, c->data);
+    Arena_release(c->arena, c->T);
+    Arena_release(c->arena, c->N);
+    Arena_release(c->arena, c->B);
+    Arena_release(c->arena, c->arclength);
+    Arena_release(c->arena, c->arc_lut);
+    Arena_release(c->arena, c->controls);
+    Arena_release(c->arena, c);
 }
\ No newline at end of file
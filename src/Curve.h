@@ -1,54 +1,187 @@
-/**
- * @file Curve.h
- * @brief Header for struct Curve
- * @author Antony Madaleno
- * @version 1.0
- * @date 13-09-2023
- *
- * Header pour les struct Curve
- *
- */
-
-#pragma once
-
-#include "Vec.h"
-#include "Quaternion.h"
-#include "Object.h"
-
-/**
- * @struct Curve3D
- */
-typedef struct Curve3D
-{
-    float * data;
-    Vec3 * T;
-    Vec3 * N;
-    Vec3 * B;
-    unsigned short npoints; //the number of points evaluated
-} Curve3D;
-
-enum methode
-{
-    BEZIER,
-    CATMULL_ROM,
-    NUBS
-};
-
-/**
- * @brief 
- * 
- * @param control_points the control points/vectors that describe de curve
- * @param n_points the number of points to be generated on the curve
- * @param mode the methode used to generate the curve from the control points/vectors
- * @return Curve3D* pointer to the result
- */
-Curve3D * Curve3D_init(Vec3* control_points, unsigned char n_control_points , const unsigned short n_points, const enum methode mode);
-
-/**
- * @brief generate the TNB frame for every evaluated point on the curve /!\ curve must have been initialized
- */
-void Curve3D_calculateTNB(Curve3D * c);
-
-Object * Curve3D_generateSurface(Curve3D * c, unsigned char meridians, Vec3 * color, Vec3 * specular_color, float shininess, float reflectivness
-, float radius);
-
+/**
+ * @file Curve.h
+ * @brief Header for struct Curve
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 13-09-2023
+ *
+ * Header pour les struct Curve
+ *
+ */
+
+#pragma once
+
+#include "Vec.h"
+#include "Quaternion.h"
+#include "Object.h"
+#include "Matrix.h"
+
+enum methode
+{
+    BEZIER,
+    CATMULL_ROM,
+    NUBS
+};
+
+/**
+ * @struct Curve3D
+ */
+typedef struct Curve3D
+{
+    float * data;
+    Vec3 * T;
+    Vec3 * N;
+    Vec3 * B;
+    unsigned int npoints; //the number of points evaluated
+    float * arclength;    //cumulative chord length at each point
+    unsigned int * arc_lut; //segment containing each uniform step of length, the cell k spans arc_lut[k] to arc_lut[k + 1]
+    float length;         //total length of the curve
+    Vec3 * controls;      //copy of the control points, used by Curve3D_updateControlPoint
+    unsigned int n_controls;
+    enum methode mode;
+    Arena * arena;        //arena of the curve and its arrays (see Arena_begin), NULL for the heap
+} Curve3D;
+
+/**
+ * @struct Curve3DRange
+ * @brief range of samples [begin, end[ of a curve
+ */
+typedef struct Curve3DRange
+{
+    unsigned int begin;
+    unsigned int end;
+} Curve3DRange;
+
+/**
+ * @brief 
+ * 
+ * @param control_points the control points/vectors that describe de curve
+ * @param n_points the number of points to be generated on the curve
+ * @param mode the methode used to generate the curve from the control points/vectors
+ * @return Curve3D* pointer to the result, from the arena of the current scope if any
+ */
+Curve3D * Curve3D_init(Vec3* control_points, unsigned int n_control_points , const unsigned int n_points, const enum methode mode);
+
+/**
+ * @brief free a curve and its arrays (samples, frames, arc length, control points),
+ * nothing is done for a curve created in an arena scope, it goes with the arena
+ */
+void Curve3D_free(Curve3D * c);
+
+/**
+ * @brief generate the TNB frame for every evaluated point on the curve /!\ curve must have been initialized
+ */
+void Curve3D_calculateTNB(Curve3D * c);
+
+/**
+ * @brief basis matrix of a method: the sample i of the curve is the sum over u of B[i][u] * control_points[u]
+ * the matrices are cached and shared, they must not be freed or modified
+ *
+ * @param n_control_points the number of control points
+ * @param n_points the number of points evaluated
+ * @param mode the methode used to generate the curve from the control points/vectors
+ * @param derivative 0 for the points, 1 for the derivative of the curve with respect to t
+ * @return Matrix* of n_control_points columns and n_points rows (NULL if invalid)
+ */
+Matrix * Curve3D_basisMatrix(unsigned int n_control_points, unsigned int n_points, const enum methode mode, const unsigned char derivative);
+
+/**
+ * @brief move one control point and re-evaluate only the samples and frames it changes
+ *
+ * @param c curve created by Curve3D_init
+ * @param idx index of the control point
+ * @param p new position of the control point
+ * @return Curve3DRange the samples whose position or frame changed (empty if nothing changed)
+ */
+Curve3DRange Curve3D_updateControlPoint(Curve3D * c, unsigned int idx, const Vec3 * p);
+
+/**
+ * @brief build the arc-length table of the curve (done by Curve3D_init), call it again if data is modified
+ */
+void Curve3D_calculateArcLength(Curve3D * c);
+
+/**
+ * @brief parameter t in [0, 1] of the point at distance s from the start of the curve
+ *
+ * @param c curve with its arc-length table
+ * @param s distance along the curve (clamped to [0, length])
+ * @return float
+ */
+float Curve3D_parameterAtDistance(Curve3D * c, float s);
+
+/**
+ * @brief point at distance s from the start of the curve, in constant time
+ *
+ * @param c curve with its arc-length table
+ * @param s distance along the curve (clamped to [0, length])
+ * @return Vec3
+ */
+Vec3 Curve3D_pointAtDistance(Curve3D * c, float s);
+
+/**
+ * @brief batch version of Curve3D_pointAtDistance (spread on the thread pool for big batches)
+ *
+ * @param c curve with its arc-length table
+ * @param distances count distances along the curve
+ * @param count number of queries
+ * @param points count points receiving the results
+ */
+void Curve3D_pointsAtDistances(Curve3D * c, const float * distances, unsigned int count, Vec3 * points);
+
+/**
+ * @brief new curve of n points evenly spaced along the arc length of c
+ *
+ * @param c curve with its arc-length table
+ * @param n the number of points of the new curve
+ * @return Curve3D* pointer to the result
+ */
+Curve3D * Curve3D_resampleUniform(Curve3D * c, unsigned int n);
+
+/**
+ * @struct Curve3DChunk
+ * @brief window of consecutive samples of a curve, with their TNB frames
+ */
+typedef struct Curve3DChunk
+{
+    float * data;
+    Vec3 * T;
+    Vec3 * N;
+    Vec3 * B;
+    unsigned int first;   //index of the first sample of the chunk on the whole curve
+    unsigned int npoints; //the number of points in the chunk
+} Curve3DChunk;
+
+/**
+ * @brief function receiving the chunks, the chunk memory is reused once it returns
+ */
+typedef void (*Curve3D_chunkFn)(const Curve3DChunk * chunk, void * args);
+
+/**
+ * @brief evaluate a curve chunk_size samples at a time without keeping the whole sample array,
+ * the frames are the same as the ones of Curve3D_calculateTNB on the whole curve
+ *
+ * @param control_points the control points/vectors that describe de curve
+ * @param n_control_points the number of control points
+ * @param n_points the number of points to be generated on the whole curve
+ * @param mode the methode used to generate the curve from the control points/vectors
+ * @param chunk_size the maximum number of points given to fn at once
+ * @param fn function called on each chunk, in order
+ * @param args arguments given to fn
+ */
+void Curve3D_generateChunked(Vec3 * control_points, unsigned int n_control_points, const unsigned int n_points, const enum methode mode,
+ const unsigned int chunk_size, Curve3D_chunkFn fn, void * args);
+
+Object * Curve3D_generateSurface(Curve3D * c, unsigned short meridians, Vec3 * color, Vec3 * specular_color, float shininess, float reflectivness
+, float radius);
+
+/**
+ * @brief rewrite the positions and normals of the rings of a tube generated by Curve3D_generateSurface for the samples in range
+ * the bounds of the tube only grow (see Object_growBounds)
+ *
+ * @param c the curve of the tube
+ * @param surface the tube
+ * @param range samples to update, as returned by Curve3D_updateControlPoint
+ * @param radius radius of the tube
+ * @return Curve3DRange the vertices of surface that changed (to give to Buffer_updateRange)
+ */
+Curve3DRange Curve3D_updateSurface(Curve3D * c, Object * surface, Curve3DRange range, float radius);
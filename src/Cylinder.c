@@ -1,117 +1,103 @@
-#include "Cylinder.h"
-#include "pthread.h"
-#include <stdio.h>
-#include <math.h>
-
-#ifndef M_PI
-#define M_PI 3.1415926535897932384626433832795
-#endif
-
-Cylinder * Cylinder_init(float h, float r)
-{
-    Cylinder * c = (Cylinder *) calloc(1, sizeof(Cylinder) );
-    c->r = r;
-    c->h = h;
-
-    return c;
-}
-
-Object * Cylinder_generateSurface(
-    Cylinder * cylinder,
-    unsigned short meridian,
-    float angle,
-    Vec3 * color,
-    Vec3 * specular,
-    float reflection,
-    float shininess
-)
-{
-
-    //CREATE THE LAYOUT
-    unsigned char * layout = (unsigned char *) calloc(6, sizeof(unsigned char));
-    layout[0] = 3; //Vertex Position
-    layout[1] = 3; //Vertex Normal
-    layout[2] = 3; //Vertex Color
-    layout[3] = 3; //Vertex Specular
-    layout[4] = 1; //Vertex Shininess
-    layout[5] = 1; //Vertex Reflection
-
-    unsigned char size = 14;
-
-    //CREATE THE OBJECT
-    Object * obj = Object_init( meridian * 2 , 6, layout, 2 * meridian );
-
-    float alpha = 0.0;
-
-    for (unsigned short i = 0; i < meridian; i++)
-    {
-
-        if (angle != 0.0)
-            alpha = ((float) i) / ((float) meridian) * angle;
-        else
-            alpha = ((float) i) / ((float) meridian) * 2 * M_PI;
-
-        //vertex bottom
-
-        obj->vertexBuffer[2 * i * size + 0]  = cylinder->r * cosf( alpha );
-        obj->vertexBuffer[2 * i * size + 1]  = 0.0f;
-        obj->vertexBuffer[2 * i * size + 2]  = cylinder->r * sinf( alpha );
-
-        obj->vertexBuffer[2 * i * size + 3]  = obj->vertexBuffer[2 * i * size + 0];
-        obj->vertexBuffer[2 * i * size + 4]  = 0.0f;
-        obj->vertexBuffer[2 * i * size + 5]  = obj->vertexBuffer[2 * i * size + 2];
-
-        obj->vertexBuffer[2 * i * size + 6]  = color->x;
-        obj->vertexBuffer[2 * i * size + 7]  = color->y;
-        obj->vertexBuffer[2 * i * size + 8]  = color->z;
-
-        obj->vertexBuffer[2 * i * size + 9]  = specular->x;
-        obj->vertexBuffer[2 * i * size + 10] = specular->y;
-        obj->vertexBuffer[2 * i * size + 11] = specular->z;
-
-        obj->vertexBuffer[2 * i * size + 12] = shininess;
-        obj->vertexBuffer[2 * i * size + 13] = reflection;
-
-        //vertex upper
-
-        obj->vertexBuffer[2 * i * size + 0 + size]  = cylinder->r * cosf( alpha );
-        obj->vertexBuffer[2 * i * size + 1 + size]  = cylinder->h;
-        obj->vertexBuffer[2 * i * size + 2 + size]  = cylinder->r * sinf( alpha );
-
-        obj->vertexBuffer[2 * i * size + 3 + size]  = obj->vertexBuffer[2 * i * size + 0];
-        obj->vertexBuffer[2 * i * size + 4 + size]  = 0.0f;
-        obj->vertexBuffer[2 * i * size + 5 + size]  = obj->vertexBuffer[2 * i * size + 2];
-
-        obj->vertexBuffer[2 * i * size + 6 + size]  = color->x;
-        obj->vertexBuffer[2 * i * size + 7 + size]  = color->y;
-        obj->vertexBuffer[2 * i * size + 8 + size]  = color->z;
-
-        obj->vertexBuffer[2 * i * size + 9 + size]  = specular->x;
-        obj->vertexBuffer[2 * i * size + 10 + size] = specular->y;
-        obj->vertexBuffer[2 * i * size + 11 + size] = specular->z;
-
-        obj->vertexBuffer[2 * i * size + 12 + size] = shininess;
-        obj->vertexBuffer[2 * i * size + 13 + size] = reflection;
-
-        //index
-        unsigned in = (i+1) % meridian;
-
-        unsigned p0 = 2 * i;
-        unsigned p1 = 2 * in;
-        unsigned p2 = 2 * i  + 1;
-        unsigned p3 = 2 * in + 1;
-
-        unsigned int index = i*6;
-
-        obj->indexBuffer[ index + 0 ] = p0;
-        obj->indexBuffer[ index + 1 ] = p2;
-        obj->indexBuffer[ index + 2 ] = p3;
-
-        obj->indexBuffer[ index + 3 ] = p0;
-        obj->indexBuffer[ index + 4 ] = p1;
-        obj->indexBuffer[ index + 5 ] = p3;
-    }
-
-    return obj;
-}
-
+#include "Cylinder.h"
+#include "ThreadPool.h"
+#include "VertexFormat.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
+
+Cylinder * Cylinder_init(float h, float r)
+{
+    Cylinder * c = (Cylinder *) calloc(1, sizeof(Cylinder) );
+    c->r = r;
+    c->h = h;
+
+    return c;
+}
+
+typedef struct Thread_args
+{
+    Object * o;
+    Cylinder * c;
+    const float * cos_a;        //cosinus and sinus of the meridian angles
+    const float * sin_a;
+    StandardVertexFormat::Vertex material;     //color, specular, shininess and reflection of every vertex
+} Thread_args;
+
+//bottom and upper vertex of each meridian of [begin, end[
+static void thread_drawMeridians(unsigned int begin, unsigned int end, void * args)
+{
+    Thread_args * t_args = (Thread_args *) args;
+    float r = t_args->c->r;
+    float h = t_args->c->h;
+    StandardVertexFormat::Vertex * v = StandardVertexFormat::vertices(t_args->o);
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        float c = t_args->cos_a[i];
+        float s = t_args->sin_a[i];
+
+        v[2 * i] = t_args->material;
+        v[2 * i].set<0>(r * c, 0.0f, r * s);
+        v[2 * i].set<1>(c, 0.0f, s);
+
+        v[2 * i + 1] = v[2 * i];
+        v[2 * i + 1].set<0>(r * c, h, r * s);
+    }
+}
+
+Object * Cylinder_generateSurface(
+    Cylinder * cylinder,
+    unsigned short meridian,
+    float angle,
+    Vec3 * color,
+    Vec3 * specular,
+    float reflection,
+    float shininess
+)
+{
+
+    //CREATE THE OBJECT (one row of a bottom and an upper vertex per meridian, the last meridian is linked to the first)
+    Object * obj = StandardVertexFormat::initGrid( meridian * 2, Object_gridIndices(meridian, 2, GRID_WRAP_ROWS, 0) );
+
+    //ANGLES OF THE MERIDIANS
+    float * cos_a = (float *) malloc(2 * (size_t) meridian * sizeof(float));
+    if (!cos_a) {
+        fprintf(stderr, "Error: Memory allocation failed for cylinder meridians.\n");
+        exit(EXIT_FAILURE);
+    }
+    float * sin_a = cos_a + meridian;
+
+    if (angle == 0.0)
+        angle = 2 * M_PI;
+
+    for (unsigned int i = 0; i < meridian; i++)
+    {
+        float alpha = ((float) i) / ((float) meridian) * angle;
+        cos_a[i] = cosf( alpha );
+        sin_a[i] = sinf( alpha );
+    }
+
+    Thread_args t_args;
+    t_args.o = obj;
+    t_args.c = cylinder;
+    t_args.cos_a = cos_a;
+    t_args.sin_a = sin_a;
+
+    t_args.material = StandardVertex_material(color, specular, shininess, reflection);
+
+    //two vertices per meridian, the workers are only worth it past a thousand meridians
+    ThreadPool_parallelFor(0, meridian, 1024, thread_drawMeridians, (void *) &t_args);
+
+    free(cos_a);
+
+    float r = fabsf(cylinder->r), h = cylinder->h;
+    float min[3] = { -r, fminf(0.0f, h), -r };
+    float max[3] = { r, fmaxf(0.0f, h), r };
+    Object_setBounds(obj, min, max, sqrtf(r * r + 0.25f * h * h));
+
+    return obj;
+}
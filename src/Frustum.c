@@ -0,0 +1,166 @@
+#include "Frustum.h"
+#include <math.h>
+#include <string.h>
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#define FRUSTUM_AVX 1
+#elif defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define FRUSTUM_SSE 1
+#endif
+
+void Frustum_init(Frustum * f, const float * view_projection)
+{
+    const float * m = view_projection;
+
+    //row i of the matrix is m[i], m[4 + i], m[8 + i], m[12 + i] : the planes are w + x, w - x, w + y, w - y, w + z and w - z
+    for (unsigned int p = 0; p < 6; p++)
+    {
+        unsigned int row = p / 2;
+        float sign = (p & 1) ? -1.0f : 1.0f;
+
+        for (unsigned int k = 0; k < 4; k++)
+            f->planes[p][k] = m[4 * k + 3] + sign * m[4 * k + row];
+
+        float l = sqrtf(f->planes[p][0] * f->planes[p][0] + f->planes[p][1] * f->planes[p][1] + f->planes[p][2] * f->planes[p][2]);
+        if (l > 0.0f)
+            for (unsigned int k = 0; k < 4; k++)
+                f->planes[p][k] /= l;
+    }
+}
+
+void Frustum_transformSphere(const Bounds * bounds, const float * model, float * sphere)
+{
+    if (!model)
+    {
+        memcpy(sphere, bounds->center, 3 * sizeof(float));
+        sphere[3] = bounds->radius;
+        return;
+    }
+
+    const float * c = bounds->center;
+    for (unsigned int k = 0; k < 3; k++)
+        sphere[k] = model[k] * c[0] + model[4 + k] * c[1] + model[8 + k] * c[2] + model[12 + k];
+
+    //largest scale : longest of the three axes of the matrix
+    float s2 = 0.0f;
+    for (unsigned int a = 0; a < 3; a++)
+    {
+        const float * axis = model + 4 * a;
+        float l2 = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+        s2 = (l2 > s2) ? l2 : s2;
+    }
+
+    sphere[3] = isfinite(bounds->radius) ? bounds->radius * sqrtf(s2) : INFINITY;
+}
+
+// the sphere is out when it is entirely behind a plane (a NaN keeps it visible)
+static unsigned char sphere_visible(const Frustum * f, const float * s)
+{
+    for (unsigned int p = 0; p < 6; p++)
+    {
+        const float * pl = f->planes[p];
+        if (pl[0] * s[0] + pl[1] * s[1] + pl[2] * s[2] + pl[3] < -s[3])
+            return 0;
+    }
+    return 1;
+}
+
+#ifdef FRUSTUM_AVX
+// visible bits of 8 spheres : spheres k and k + 4 are loaded in the two halves, then transposed in each half
+static unsigned int cull8(const __m256 (* planes)[4], const float * s)
+{
+    __m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(s)), _mm_loadu_ps(s + 16), 1);
+    __m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(s + 4)), _mm_loadu_ps(s + 20), 1);
+    __m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(s + 8)), _mm_loadu_ps(s + 24), 1);
+    __m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(s + 12)), _mm_loadu_ps(s + 28), 1);
+
+    __m256 t0 = _mm256_unpacklo_ps(r0, r1);
+    __m256 t1 = _mm256_unpackhi_ps(r0, r1);
+    __m256 t2 = _mm256_unpacklo_ps(r2, r3);
+    __m256 t3 = _mm256_unpackhi_ps(r2, r3);
+
+    __m256 x = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 y = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+    __m256 z = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+    __m256 nr = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2)));
+
+    __m256 out = _mm256_setzero_ps();
+    for (unsigned int p = 0; p < 6; p++)
+    {
+        __m256 d = _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(x, planes[p][0]), _mm256_mul_ps(y, planes[p][1])),
+                                 _mm256_add_ps(_mm256_mul_ps(z, planes[p][2]), planes[p][3]));
+        out = _mm256_or_ps(out, _mm256_cmp_ps(d, nr, _CMP_LT_OQ));
+    }
+
+    return ~(unsigned int) _mm256_movemask_ps(out) & 0xffu;
+}
+#endif
+
+#ifdef FRUSTUM_SSE
+// visible bits of 4 spheres
+static unsigned int cull4(const __m128 (* planes)[4], const float * s)
+{
+    __m128 x = _mm_loadu_ps(s);
+    __m128 y = _mm_loadu_ps(s + 4);
+    __m128 z = _mm_loadu_ps(s + 8);
+    __m128 r = _mm_loadu_ps(s + 12);
+    _MM_TRANSPOSE4_PS(x, y, z, r);
+    __m128 nr = _mm_sub_ps(_mm_setzero_ps(), r);
+
+    __m128 out = _mm_setzero_ps();
+    for (unsigned int p = 0; p < 6; p++)
+    {
+        __m128 d = _mm_add_ps(_mm_add_ps(_mm_mul_ps(x, planes[p][0]), _mm_mul_ps(y, planes[p][1])),
+                              _mm_add_ps(_mm_mul_ps(z, planes[p][2]), planes[p][3]));
+        out = _mm_or_ps(out, _mm_cmplt_ps(d, nr));
+    }
+
+    return ~(unsigned int) _mm_movemask_ps(out) & 0xfu;
+}
+#endif
+
+unsigned int Frustum_cullSpheres(const Frustum * f, const float * spheres, unsigned int count, unsigned char * visible)
+{
+    unsigned int n_visible = 0;
+    unsigned int i = 0;
+
+#if defined(FRUSTUM_AVX) || defined(FRUSTUM_SSE)
+    //the planes broadcast once for every batch
+#ifdef FRUSTUM_AVX
+    __m256 planes[6][4];
+    for (unsigned int p = 0; p < 6; p++)
+        for (unsigned int k = 0; k < 4; k++)
+            planes[p][k] = _mm256_set1_ps(f->planes[p][k]);
+#else
+    __m128 planes[6][4];
+    for (unsigned int p = 0; p < 6; p++)
+        for (unsigned int k = 0; k < 4; k++)
+            planes[p][k] = _mm_set1_ps(f->planes[p][k]);
+#endif
+
+    for (; i + 8 <= count; i += 8)
+    {
+        const float * s = spheres + 4 * (size_t) i;
+#ifdef FRUSTUM_AVX
+        unsigned int mask = cull8(planes, s);
+#else
+        unsigned int mask = cull4(planes, s) | (cull4(planes, s + 16) << 4);
+#endif
+        for (unsigned int k = 0; k < 8; k++)
+        {
+            visible[i + k] = (unsigned char) ((mask >> k) & 1u);
+            n_visible += visible[i + k];
+        }
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        visible[i] = sphere_visible(f, spheres + 4 * (size_t) i);
+        n_visible += visible[i];
+    }
+
+    return n_visible;
+}
\ No newline at end of file
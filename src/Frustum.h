@@ -0,0 +1,56 @@
+/**
+ * @file Frustum.h
+ * @brief Header for struct Frustum
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 19-10-2026
+ *
+ * Header pour l'élimination des objets hors du champ de la caméra (sphères englobantes testées par paquets de 8)
+ *
+ */
+
+#pragma once
+
+#include "Object.h"
+
+/**
+ * @struct Frustum
+ * @brief the six planes of the view volume (left, right, bottom, top, near, far), a x + b y + c z + d >= 0 inside
+ * with (a, b, c) of unit length so that d is a distance
+ */
+typedef struct Frustum
+{
+    float planes[6][4];
+} Frustum;
+
+/**
+ * @brief planes of the matrix u_projection * u_view (column major, as glm::value_ptr gives it)
+ * the planes are in world space, the spheres tested against them must be too
+ *
+ * @param f
+ * @param view_projection 16 floats
+ */
+void Frustum_init(Frustum * f, const float * view_projection);
+
+/**
+ * @brief bounding sphere of an object moved by its model matrix : the center is transformed
+ * and the radius grown by the largest scale of the matrix
+ *
+ * @param bounds bounds of the object (Object.bounds)
+ * @param model 16 floats, column major, NULL for the identity
+ * @param sphere receives the center and the radius (4 floats), the radius stays INFINITY for unknown bounds
+ */
+void Frustum_transformSphere(const Bounds * bounds, const float * model, float * sphere);
+
+/**
+ * @brief test spheres against the planes, 8 at a time (AVX, or SSE 4 by 4, scalar otherwise)
+ * a sphere is visible unless it is entirely behind one of the planes, so a few spheres near
+ * the corners are kept although they are out : the test never culls a visible object
+ *
+ * @param f
+ * @param spheres count spheres of 4 floats (center then radius), see Frustum_transformSphere
+ * @param count
+ * @param visible count bytes receiving 1 if the sphere may be seen, 0 if its draw can be skipped
+ * @return unsigned int number of visible spheres
+ */
+unsigned int Frustum_cullSpheres(const Frustum * f, const float * spheres, unsigned int count, unsigned char * visible);
\ No newline at end of file
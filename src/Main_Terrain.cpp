@@ -0,0 +1,272 @@
+/**
+g++ -o ../bin/Terrain.exe Main_Terrain.cpp Transform.cpp Shader.cpp Curve.c Sphere.c Surface.c Vec.c Quaternion.c Object.c Matrix.c Image.c Buffer.cpp MeshCache.cpp MeshCodec.c Arena.c Frustum.c Skybox.cpp Texture.cpp Cylinder.c ThreadPool.c Terrain.c -lglfw3 -lglew32 -lgdi32 -lopengl32 -lpthread
+**/
+#include <iostream>
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+#include <string>
+#include <cstdlib>
+#include <cmath>
+#include <time.h>
+#include <unistd.h>
+
+#include "Shader.hpp"
+
+#include "Terrain.h"
+#include "Matrix.h"
+
+#include "Buffer.h"
+#include "Frustum.h"
+#include "Image.h"
+#include "Texture.h"
+
+//GLM INCLUDES
+#include "include/glm/vec3.hpp" // glm::vec3
+#include "include/glm/vec4.hpp" // glm::vec4
+#include "include/glm/mat4x4.hpp" // glm::mat4
+#include "include/glm/gtc/matrix_transform.hpp" // glm::translate, glm::rotate, glm::scale, glm::perspective
+#include "include/glm/gtc/type_ptr.hpp" // glm::value_ptr
+
+#define V_SYNC 1
+
+#define HEIGHTMAP_SIZE 1025     //samples per side
+#define CHUNK_QUADS 64
+#define LOD_LEVELS 5
+
+// GLFW callback function for handling window resize
+void framebuffer_size_callback(GLFWwindow * window, int width, int height)
+{
+    glViewport(0, 0, width, height);
+}
+
+// the GL buffer of a chunk goes with its object
+void chunk_evicted(TerrainChunk * chunk)
+{
+    Buffer_free((Buffer *) chunk->user);
+}
+
+// a few octaves of waves, enough to see the levels of detail change
+Matrix * heightmap_generate(unsigned short n)
+{
+    Matrix * h = Matrix_generate(n, n);
+
+    for (unsigned short i = 0; i < n; i++)
+        for (unsigned short j = 0; j < n; j++)
+        {
+            float x = (float) j / (float) (n - 1);
+            float z = (float) i / (float) (n - 1);
+            float y = 0.0f;
+            float amplitude = 1.0f;
+            float frequency = 3.0f;
+
+            for (unsigned char o = 0; o < 5; o++)
+            {
+                y += amplitude * sinf(6.2831853f * frequency * x + 1.7f * o) * cosf(6.2831853f * frequency * z - 0.9f * o);
+                amplitude *= 0.45f;
+                frequency *= 2.1f;
+            }
+            h->data[(size_t) i * n + j] = 0.5f + 0.3f * y;
+        }
+
+    return h;
+}
+
+int main() {
+
+    // Initialize GLFW
+    if ( !glfwInit() )
+    {
+        std::cerr << "Failed to initialize GLFW." << std::endl;
+        return -1;
+    }
+
+    // Configure GLFW
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+
+    // Enable V-Sync (1) or disable it (0)
+    glfwSwapInterval(V_SYNC); // Enable V-Sync (limits frame rate to the refresh rate)
+
+    // Create a GLFW window
+    GLFWwindow* window = glfwCreateWindow(1600, 900, "App Window", NULL, NULL);
+    if (!window)
+    {
+        std::cerr << "Failed to create GLFW window." << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+    glfwMakeContextCurrent(window);
+
+    // Initialize GLEW
+    if (glewInit() != GLEW_OK)
+    {
+        std::cerr << "Failed to initialize GLEW." << std::endl;
+        glfwTerminate();
+        return -1;
+    }
+
+    // Set the OpenGL viewport size and callback function
+    int screenWidth, screenHeight;
+    glfwGetFramebufferSize(window, &screenWidth, &screenHeight);
+    glViewport(0, 0, screenWidth, screenHeight);
+    glfwSetFramebufferSizeCallback(window, framebuffer_size_callback);
+
+    // Print the OpenGL version
+    printf("OpenGL version: %s\n", glGetString(GL_VERSION));
+
+    // Create a Shader object : the chunks morph to their parent level in the vertex shader
+    Shader shader("../shaders/terrain_vertex.vs", "../shaders/Phong_v2.vs");
+
+    // Use the shader program
+    shader.use();
+
+    //Set Shader uniforms
+
+    //lights
+    shader.setFloat("u_specularStrength", 0.2f);
+
+    unsigned char light_count = 1;
+    shader.setInt("u_light_count", light_count);
+
+    glm::vec3 * lights_Colors = (glm::vec3 *) calloc(light_count , sizeof(glm::vec3));
+    glm::vec3 * lights_Positions = (glm::vec3 *) calloc(light_count , sizeof(glm::vec3));
+
+    lights_Colors[0]    = glm::vec3( 1.0f,  1.0f,  1.0f);
+    lights_Positions[0] = glm::vec3( 100.0f,  200.0f,  100.0f);
+
+    shader.setVec3_array("u_lights_Colors", lights_Colors[0], light_count);
+    shader.setVec3_array("u_lights_Positions", lights_Positions[0], light_count);
+
+    //MVP
+    glm::mat4 u_model(1.0f);
+    glm::mat4 u_view(1.0f);
+    glm::mat4 u_projection(1.0f);
+
+    // View matrix: the camera flies over the terrain
+    glm::vec3 cameraPosition    = glm::vec3(100.0f, 30.0f, 20.0f);
+    glm::vec3 cameraTarget      = glm::vec3(100.0f, 0.0f, 100.0f);
+    glm::vec3 cameraUp          = glm::vec3(0.0f, 1.0f, 0.0f);
+
+    u_view = glm::lookAt(cameraPosition, cameraTarget, cameraUp);
+
+    // Projection matrix: Set up the perspective projection
+    float aspectRatio   = 16.f/9.f;                                 // Adjust as needed
+    float fieldOfView   = glm::radians(45.0f);                      // Field of view in radians
+    float nearClip      = 0.1f;                                     // Near clipping plane
+    float farClip       = 500.0f;                                   // Far clipping plane
+
+    u_projection = glm::perspective(fieldOfView, aspectRatio, nearClip, farClip);
+
+    shader.setMat4("u_model", u_model, GL_FALSE);
+    shader.setMat4("u_view", u_view, GL_FALSE);
+    shader.setMat4("u_projection", u_projection, GL_FALSE);
+
+    //view
+    shader.setVec3("u_viewPos", cameraPosition);
+
+    //LOAD SKYBOX
+    const char * fpath = "../textures/skybox/Fall_Creek.bmp";
+
+    Texture * skybox = Texture_init(fpath);
+    shader.setInt("u_environmentMap", skybox->ID);
+
+    //TERRAIN : chunks generated by the workers, then uploaded here once ready
+    Matrix * heights = heightmap_generate(HEIGHTMAP_SIZE);
+
+    Vec3 size, color, specular_color;
+    Vec3_set(&size, 200.0f, 20.0f, 200.0f);
+    Vec3_set(&color, 0.36f, 0.5f, 0.28f);
+    Vec3_set(&specular_color, 0.2f, 0.2f, 0.2f);
+
+    Terrain * terrain = Terrain_init(heights, &size, CHUNK_QUADS, LOD_LEVELS, 25.0f, (size_t) 96 << 20, &color, &specular_color, 8.0f, 0.0f);
+    if (!terrain)
+        return -1;
+    terrain->on_evict = chunk_evicted;
+
+    //at most every chunk of the finest level is selected
+    unsigned int max_selected = terrain->n_x[0] * terrain->n_z[0];
+    TerrainChunk ** selected = (TerrainChunk **) calloc(max_selected, sizeof(TerrainChunk *));
+    float * spheres = (float *) calloc(4 * (size_t) max_selected, sizeof(float));
+    unsigned char * visible = (unsigned char *) calloc(max_selected, sizeof(unsigned char));
+
+    // Enable depth test
+    glEnable(GL_DEPTH_TEST);
+    // Accept fragment if it closer to the camera than the former one
+    glDepthFunc(GL_LESS);
+    glDisable(GL_CULL_FACE);
+
+    // Bind the shader program
+    shader.use();
+
+    // Main rendering loop
+    while (!glfwWindowShouldClose(window))
+    {
+        // Input handling (if needed)
+        // Render
+        glClearColor(0.5f, 0.65f, 0.8f, 1.0f);
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT); // Clear both color and depth buffers;
+
+        float t         = (float) glfwGetTime() / 20.0f;
+        cameraPosition  = glm::vec3(100.0f + 80.0f * sinf(t), 25.0f + 10.0f * sinf(3.0f * t), 100.0f + 80.0f * cosf(t));
+        cameraTarget    = glm::vec3(100.0f + 80.0f * sinf(t + 0.3f), 5.0f, 100.0f + 80.0f * cosf(t + 0.3f));
+
+        u_view = glm::lookAt(cameraPosition, cameraTarget, cameraUp);
+        shader.setMat4("u_view", u_view, GL_FALSE);
+        shader.setVec3("u_viewPos", cameraPosition);
+
+        // Chunks around the eye, their parents stand in until they are ready
+        Vec3 eye;
+        Vec3_set(&eye, cameraPosition.x, cameraPosition.y, cameraPosition.z);
+        unsigned int count = Terrain_select(terrain, &eye, selected, max_selected);
+
+        // Chunks out of the view are neither uploaded nor drawn
+        Frustum frustum;
+        glm::mat4 view_projection = u_projection * u_view;
+        Frustum_init(&frustum, glm::value_ptr(view_projection));
+
+        for (unsigned int k = 0; k < count; k++)
+            Frustum_transformSphere(&selected[k]->object->bounds, NULL, spheres + 4 * k);
+        Frustum_cullSpheres(&frustum, spheres, count, visible);
+
+        // Draw
+        for (unsigned int k = 0; k < count; k++)
+        {
+            if (!visible[k])
+                continue;
+
+            TerrainChunk * chunk = selected[k];
+            if (!chunk->user)
+                chunk->user = Buffer_init(chunk->object);
+
+            shader.setFloat("u_morphStart", chunk->morph_start);
+            shader.setFloat("u_morphEnd", chunk->morph_end);
+            Buffer_draw((Buffer *) chunk->user);
+        }
+
+        glBindVertexArray(0);
+
+        // Swap buffers and poll events
+        glfwSwapBuffers(window);
+        glfwPollEvents();
+    }
+
+    // Unbind the VAO
+    glBindVertexArray(0);
+
+    // the buffers of the chunks are freed by chunk_evicted
+    Terrain_free(terrain);
+    Matrix_free(heights);
+
+    free(selected);
+    free(spheres);
+    free(visible);
+    free(lights_Colors);
+    free(lights_Positions);
+    Texture_free(skybox);
+
+    shader.erase();
+    // Clean up and terminate GLFW
+    glfwTerminate();
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+#include "MeshCache.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
+
+#define MESH_BUCKETS 64
+
+static Mesh * mesh_buckets[MESH_BUCKETS] = { NULL };
+
+static char mesh_directory[512] = "";
+
+//version of the generators and of the processing in mesh_get : increment it with any change to the vertices
+//or indices they give for the same key, the files of the previous versions are then never loaded
+#define MESH_PIPELINE_VERSION 1
+
+//FNV-1a over the version then the bytes of the key (its padding is zeroed by mesh_key)
+static unsigned long long mesh_hash(const MeshKey * key)
+{
+    unsigned int version = MESH_PIPELINE_VERSION;
+    return Object_hash(key, sizeof(MeshKey), Object_hash(&version, sizeof(version), 0));
+}
+
+static void mesh_key(MeshKey * key, unsigned char type, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    memset(key, 0, sizeof(MeshKey));
+    key->type = type;
+    key->material[0] = color->x;
+    key->material[1] = color->y;
+    key->material[2] = color->z;
+    key->material[3] = specular->x;
+    key->material[4] = specular->y;
+    key->material[5] = specular->z;
+    key->material[6] = shininess;
+    key->material[7] = reflection;
+}
+
+static Object * mesh_generate(const MeshKey * key)
+{
+    Vec3 color, specular;
+    Vec3_set(&color, key->material[0], key->material[1], key->material[2]);
+    Vec3_set(&specular, key->material[3], key->material[4], key->material[5]);
+    float shininess = key->material[6];
+    float reflection = key->material[7];
+
+    if (key->type == MESH_CYLINDER)
+    {
+        Cylinder cylinder;
+        cylinder.h = key->size[0];
+        cylinder.r = key->size[1];
+        return Cylinder_generateSurface(&cylinder, (unsigned short) key->resolution[0], key->angle, &color, &specular, reflection, shininess);
+    }
+
+    Sphere sphere;
+    sphere.rx = key->size[0];
+    sphere.ry = key->size[1];
+    sphere.rz = key->size[2];
+
+    if (key->type == MESH_ICOSPHERE)
+        return Sphere_generateIcosphere(&sphere, (unsigned char) key->resolution[0], 0, &color, &specular, reflection, shininess);
+    if (key->type == MESH_OCTASPHERE)
+        return Sphere_generateOctasphere(&sphere, (unsigned char) key->resolution[0], 0, &color, &specular, reflection, shininess);
+
+    return Sphere_generateSurface(&sphere, (unsigned short) key->resolution[0], (unsigned short) key->resolution[1], &color, &specular, reflection, shininess);
+}
+
+static Mesh * mesh_get(const MeshKey * key)
+{
+    unsigned long long hash = mesh_hash(key);
+    Mesh ** bucket = &mesh_buckets[hash % MESH_BUCKETS];
+
+    Mesh * m = *bucket;
+    while (m && !(m->hash == hash && memcmp(&m->key, key, sizeof(MeshKey)) == 0))
+        m = m->next;
+
+    if (m)
+    {
+        m->refs++;
+        return m;
+    }
+
+    m = (Mesh *) calloc(1, sizeof(Mesh));
+    if (!m) {
+        fprintf(stderr, "Error: Memory allocation failed for mesh cache.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    m->key = *key;
+    m->hash = hash;
+    m->refs = 1;
+
+    //a file from a previous run holds the object as it is after compaction and optimization
+    char path[600];
+    snprintf(path, sizeof(path), "%s/%016llx.mesh", mesh_directory, hash);
+    m->object = mesh_directory[0] ? Object_load(path, hash) : NULL;
+
+    if (!m->object)
+    {
+        m->object = Object_compact(mesh_generate(key));     //the material is in the key, it is given per draw
+        Object_optimizeIndices(m->object, 32, 1, NULL, NULL);   //uploaded once, drawn every frame
+        if (mesh_directory[0] && !Object_save(m->object, path, hash))
+            fprintf(stderr, "Warning: Cannot write the mesh file '%s'.\n", path);
+    }
+    m->buffer = Buffer_init(m->object);
+
+    m->next = *bucket;
+    *bucket = m;
+    return m;
+}
+
+void MeshCache_setDirectory(const char * directory)
+{
+    if (!directory)
+    {
+        mesh_directory[0] = '\0';
+        return;
+    }
+
+    if (strlen(directory) >= sizeof(mesh_directory)) {
+        fprintf(stderr, "Error: Mesh directory path too long.\n");
+        exit(EXIT_FAILURE);
+    }
+    strcpy(mesh_directory, directory);
+
+    //already there most of the time, the files say if it could not be created
+#ifdef _WIN32
+    _mkdir(directory);
+#else
+    mkdir(directory, 0755);
+#endif
+}
+
+Mesh * MeshCache_sphere(Sphere * sphere, unsigned short meridian, unsigned short parallel, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    MeshKey key;
+    mesh_key(&key, MESH_SPHERE, color, specular, reflection, shininess);
+    key.size[0] = sphere->rx;
+    key.size[1] = sphere->ry;
+    key.size[2] = sphere->rz;
+    key.resolution[0] = meridian;
+    key.resolution[1] = parallel;
+
+    return mesh_get(&key);
+}
+
+Mesh * MeshCache_icosphere(Sphere * sphere, unsigned char subdivision, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    MeshKey key;
+    mesh_key(&key, MESH_ICOSPHERE, color, specular, reflection, shininess);
+    key.size[0] = sphere->rx;
+    key.size[1] = sphere->ry;
+    key.size[2] = sphere->rz;
+    key.resolution[0] = subdivision;
+
+    return mesh_get(&key);
+}
+
+Mesh * MeshCache_octasphere(Sphere * sphere, unsigned char subdivision, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    MeshKey key;
+    mesh_key(&key, MESH_OCTASPHERE, color, specular, reflection, shininess);
+    key.size[0] = sphere->rx;
+    key.size[1] = sphere->ry;
+    key.size[2] = sphere->rz;
+    key.resolution[0] = subdivision;
+
+    return mesh_get(&key);
+}
+
+Mesh * MeshCache_cylinder(Cylinder * cylinder, unsigned short meridian, float angle, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    MeshKey key;
+    mesh_key(&key, MESH_CYLINDER, color, specular, reflection, shininess);
+    key.size[0] = cylinder->h;
+    key.size[1] = cylinder->r;
+    key.resolution[0] = meridian;
+    key.angle = (angle != 0.0f) ? angle : (float) (2 * M_PI);   //0 draws the whole cylinder too
+
+    return mesh_get(&key);
+}
+
+void MeshCache_release(Mesh * mesh)
+{
+    if (!mesh || --mesh->refs > 0)
+        return;
+
+    Mesh ** link = &mesh_buckets[mesh->hash % MESH_BUCKETS];
+    while (*link != mesh)
+        link = &(*link)->next;
+    *link = mesh->next;
+
+    Buffer_free(mesh->buffer);
+    Object_free(mesh->object);
+    free(mesh);
+}
\ No newline at end of file
@@ -0,0 +1,101 @@
+/**
+ * @file MeshCache.h
+ * @brief Header for struct Mesh
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 19-10-2026
+ *
+ * Header pour le cache des primitives (un seul Object et Buffer par jeu de paramètres)
+ *
+ */
+
+#pragma once
+
+#ifndef MESH_CACHE
+#define MESH_CACHE
+
+#include "Object.h"
+#include "Buffer.h"
+#include "Sphere.h"
+#include "Cylinder.h"
+
+#define MESH_SPHERE 0
+#define MESH_ICOSPHERE 1
+#define MESH_OCTASPHERE 2
+#define MESH_CYLINDER 3
+
+/**
+ * @brief everything that defines the vertices of a primitive, two meshes with the same key are identical
+ */
+typedef struct MeshKey
+{
+    unsigned char type;         //MESH_*
+    float size[3];              //radii of the sphere, height and radius of the cylinder
+    unsigned int resolution[2]; //meridians and parallels, subdivision, meridians
+    float angle;                //portion of the cylinder
+    float material[8];          //color, specular, shininess and reflection
+} MeshKey;
+
+/**
+ * @struct Mesh
+ * @brief primitive generated and uploaded once, shared by every user asking for the same key
+ * its object is compact (see Object_compact) and its indices are optimized (see Object_optimizeIndices),
+ * they are then owned by the object and uploaded in 16 bits whenever the vertex count allows it (see Buffer_init)
+ */
+typedef struct Mesh
+{
+    MeshKey key;
+    unsigned long long hash;
+    unsigned int refs;
+    Object * object;
+    Buffer * buffer;
+    struct Mesh * next;
+} Mesh;
+
+/**
+ * @brief directory where the meshes are saved once generated and loaded by the next runs (see Object_load),
+ * files are named after the hash of their key and of MESH_PIPELINE_VERSION (MeshCache.cpp), NULL to only keep them in memory
+ * the version must be incremented when a generator or the processing of the meshes changes
+ *
+ * @param directory created if missing
+ */
+void MeshCache_setDirectory(const char * directory);
+
+/**
+ * @brief shared UV sphere (see Sphere_generateSurface), generated and uploaded on first request
+ * the cache creates GL objects : call it from the thread owning the context
+ *
+ * @param sphere
+ * @param meridian
+ * @param parallel
+ * @param color
+ * @param specular
+ * @param reflection
+ * @param shininess
+ * @return Mesh* to give back with MeshCache_release
+ */
+Mesh * MeshCache_sphere(Sphere * sphere, unsigned short meridian, unsigned short parallel, Vec3 * color, Vec3 * specular, float reflection, float shininess);
+
+/**
+ * @brief shared icosphere (see Sphere_generateIcosphere)
+ */
+Mesh * MeshCache_icosphere(Sphere * sphere, unsigned char subdivision, Vec3 * color, Vec3 * specular, float reflection, float shininess);
+
+/**
+ * @brief shared octasphere (see Sphere_generateOctasphere)
+ */
+Mesh * MeshCache_octasphere(Sphere * sphere, unsigned char subdivision, Vec3 * color, Vec3 * specular, float reflection, float shininess);
+
+/**
+ * @brief shared cylinder (see Cylinder_generateSurface)
+ */
+Mesh * MeshCache_cylinder(Cylinder * cylinder, unsigned short meridian, float angle, Vec3 * color, Vec3 * specular, float reflection, float shininess);
+
+/**
+ * @brief give back a mesh, its object and GL buffers are freed with the last reference
+ *
+ * @param mesh
+ */
+void MeshCache_release(Mesh * mesh);
+
+#endif
\ No newline at end of file
@@ -0,0 +1,415 @@
+#include "MeshCodec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define CODEC_SSE2 1
+#endif
+
+#define CODEC_VERTEX_TAG 0xa1
+#define CODEC_INDEX_TAG 0xb1
+#define CODEC_GROUP 16
+#define CODEC_BLOCK_BYTES 8192      //one block of byte planes stays in the L1 cache
+#define CODEC_MAX_STRIDE 256
+
+#define PREDICT_PREVIOUS 0          //index k from index k - 1
+#define PREDICT_CORNER 1            //index k from index k - 3
+#define PREDICT_QUAD 2              //index k from index k - 6, the same corner of the previous quad of a grid
+
+static const unsigned int predict_distances[3] = {1, 3, 6};
+
+// vertices per block, a multiple of the group size
+static unsigned int block_vertices(size_t stride)
+{
+    unsigned int count = (unsigned int) (CODEC_BLOCK_BYTES / stride) & ~(CODEC_GROUP - 1);
+    count = (count < CODEC_GROUP) ? CODEC_GROUP : count;
+    return (count > 256) ? 256 : count;
+}
+
+static size_t plane_bound(unsigned int count)
+{
+    unsigned int groups = (count + CODEC_GROUP - 1) / CODEC_GROUP;
+    return (groups + 3) / 4 + (size_t) groups * CODEC_GROUP;
+}
+
+static unsigned char zigzag8(unsigned char d)
+{
+    return (unsigned char) ((d << 1) ^ (unsigned char) ((signed char) d >> 7));
+}
+
+#ifndef CODEC_SSE2
+static unsigned char unzigzag8(unsigned char z)
+{
+    return (unsigned char) ((z >> 1) ^ (unsigned char) -(z & 1));
+}
+#endif
+
+// one byte plane : 2 bits of width per group in a header, then the groups
+static unsigned char * encode_plane(unsigned char * dst, const unsigned char * values, unsigned int count)
+{
+    unsigned int groups = (count + CODEC_GROUP - 1) / CODEC_GROUP;
+    unsigned char * header = dst;
+    dst += (groups + 3) / 4;
+    memset(header, 0, (groups + 3) / 4);
+
+    for (unsigned int g = 0; g < groups; g++)
+    {
+        unsigned char group[CODEC_GROUP] = { 0 };
+        unsigned int n = (count - g * CODEC_GROUP < CODEC_GROUP) ? count - g * CODEC_GROUP : CODEC_GROUP;
+        memcpy(group, values + g * CODEC_GROUP, n);
+
+        unsigned char max = 0;
+        for (unsigned int k = 0; k < CODEC_GROUP; k++)
+            max = (group[k] > max) ? group[k] : max;
+
+        unsigned char width = (max == 0) ? 0 : (max < 4) ? 1 : (max < 16) ? 2 : 3;
+        header[g / 4] |= (unsigned char) (width << (2 * (g % 4)));
+
+        if (width == 1)
+        {
+            //byte j holds the values j, j + 4, j + 8 and j + 12
+            for (unsigned int j = 0; j < 4; j++)
+                *dst++ = (unsigned char) (group[j] | group[j + 4] << 2 | group[j + 8] << 4 | group[j + 12] << 6);
+        }
+        else if (width == 2)
+        {
+            //byte j holds the values j and j + 8
+            for (unsigned int j = 0; j < 8; j++)
+                *dst++ = (unsigned char) (group[j] | group[j + 8] << 4);
+        }
+        else if (width == 3)
+        {
+            memcpy(dst, group, CODEC_GROUP);
+            dst += CODEC_GROUP;
+        }
+    }
+
+    return dst;
+}
+
+#ifdef CODEC_SSE2
+
+static const unsigned char * decode_group(const unsigned char * src, const unsigned char * end, unsigned char width, __m128i * out)
+{
+    static const size_t sizes[4] = {0, 4, 8, 16};
+    if ((size_t) (end - src) < sizes[width])
+        return NULL;
+
+    if (width == 0)
+    {
+        *out = _mm_setzero_si128();
+    }
+    else if (width == 1)
+    {
+        int bits;
+        memcpy(&bits, src, 4);
+        __m128i x = _mm_cvtsi32_si128(bits);
+        __m128i mask = _mm_set1_epi8(3);
+        __m128i a = _mm_and_si128(x, mask);
+        __m128i b = _mm_and_si128(_mm_srli_epi16(x, 2), mask);
+        __m128i c = _mm_and_si128(_mm_srli_epi16(x, 4), mask);
+        __m128i d = _mm_and_si128(_mm_srli_epi16(x, 6), mask);
+        *out = _mm_unpacklo_epi64(_mm_unpacklo_epi32(a, b), _mm_unpacklo_epi32(c, d));
+    }
+    else if (width == 2)
+    {
+        __m128i x = _mm_loadl_epi64((const __m128i *) src);
+        __m128i mask = _mm_set1_epi8(15);
+        *out = _mm_unpacklo_epi64(_mm_and_si128(x, mask), _mm_and_si128(_mm_srli_epi16(x, 4), mask));
+    }
+    else
+    {
+        *out = _mm_loadu_si128((const __m128i *) src);
+    }
+
+    return src + sizes[width];
+}
+
+// prefix sums of the zigzag differences of a group, continuing from last
+static __m128i delta_group(__m128i z, unsigned char last)
+{
+    __m128i one = _mm_set1_epi8(1);
+    __m128i d = _mm_xor_si128(_mm_and_si128(_mm_srli_epi16(z, 1), _mm_set1_epi8(0x7f)), _mm_sub_epi8(_mm_setzero_si128(), _mm_and_si128(z, one)));
+
+    d = _mm_add_epi8(d, _mm_slli_si128(d, 1));
+    d = _mm_add_epi8(d, _mm_slli_si128(d, 2));
+    d = _mm_add_epi8(d, _mm_slli_si128(d, 4));
+    d = _mm_add_epi8(d, _mm_slli_si128(d, 8));
+    return _mm_add_epi8(d, _mm_set1_epi8((char) last));
+}
+
+#else
+
+static const unsigned char * decode_group(const unsigned char * src, const unsigned char * end, unsigned char width, unsigned char * out)
+{
+    static const size_t sizes[4] = {0, 4, 8, 16};
+    if ((size_t) (end - src) < sizes[width])
+        return NULL;
+
+    for (unsigned int k = 0; k < CODEC_GROUP; k++)
+    {
+        if (width == 0)
+            out[k] = 0;
+        else if (width == 1)
+            out[k] = (src[k % 4] >> (2 * (k / 4))) & 3;
+        else if (width == 2)
+            out[k] = (src[k % 8] >> (4 * (k / 8))) & 15;
+        else
+            out[k] = src[k];
+    }
+
+    return src + sizes[width];
+}
+
+#endif
+
+// one byte plane into values (count rounded up to the group size), prefix summed from last when delta is set
+static const unsigned char * decode_plane(const unsigned char * src, const unsigned char * end, unsigned char * values, unsigned int count, int delta, unsigned char last)
+{
+    unsigned int groups = (count + CODEC_GROUP - 1) / CODEC_GROUP;
+    const unsigned char * header = src;
+    if ((size_t) (end - src) < (groups + 3) / 4)
+        return NULL;
+    src += (groups + 3) / 4;
+
+    for (unsigned int g = 0; g < groups; g++)
+    {
+        unsigned char width = (header[g / 4] >> (2 * (g % 4))) & 3;
+#ifdef CODEC_SSE2
+        __m128i v;
+        src = decode_group(src, end, width, &v);
+        if (!src)
+            return NULL;
+        if (delta)
+        {
+            v = delta_group(v, last);
+            last = (unsigned char) (_mm_cvtsi128_si32(_mm_srli_si128(v, 15)) & 0xff);
+        }
+        _mm_storeu_si128((__m128i *) (values + g * CODEC_GROUP), v);
+#else
+        unsigned char * v = values + g * CODEC_GROUP;
+        src = decode_group(src, end, width, v);
+        if (!src)
+            return NULL;
+        if (delta)
+            for (unsigned int k = 0; k < CODEC_GROUP; k++)
+                v[k] = last = (unsigned char) (last + unzigzag8(v[k]));
+#endif
+    }
+
+    return src;
+}
+
+// planes of a block (plane b holds byte b of each element) back to elements of stride bytes
+static void transpose_block(unsigned char * dst, const unsigned char * planes, unsigned int pitch, unsigned int count, size_t stride)
+{
+    for (size_t w = 0; w < stride; w += 4)
+    {
+        const unsigned char * p0 = planes + (w + 0) * pitch;
+        const unsigned char * p1 = planes + (w + 1) * pitch;
+        const unsigned char * p2 = planes + (w + 2) * pitch;
+        const unsigned char * p3 = planes + (w + 3) * pitch;
+        unsigned int k = 0;
+
+#ifdef CODEC_SSE2
+        //16 elements : the 4 planes interleaved into 16 words
+        for (; k + CODEC_GROUP <= count; k += CODEC_GROUP)
+        {
+            __m128i a = _mm_loadu_si128((const __m128i *) (p0 + k));
+            __m128i b = _mm_loadu_si128((const __m128i *) (p1 + k));
+            __m128i c = _mm_loadu_si128((const __m128i *) (p2 + k));
+            __m128i d = _mm_loadu_si128((const __m128i *) (p3 + k));
+            __m128i ab0 = _mm_unpacklo_epi8(a, b), ab1 = _mm_unpackhi_epi8(a, b);
+            __m128i cd0 = _mm_unpacklo_epi8(c, d), cd1 = _mm_unpackhi_epi8(c, d);
+
+            unsigned int words[CODEC_GROUP];
+            _mm_storeu_si128((__m128i *) (words + 0), _mm_unpacklo_epi16(ab0, cd0));
+            _mm_storeu_si128((__m128i *) (words + 4), _mm_unpackhi_epi16(ab0, cd0));
+            _mm_storeu_si128((__m128i *) (words + 8), _mm_unpacklo_epi16(ab1, cd1));
+            _mm_storeu_si128((__m128i *) (words + 12), _mm_unpackhi_epi16(ab1, cd1));
+
+            for (unsigned int j = 0; j < CODEC_GROUP; j++)
+                memcpy(dst + (size_t) (k + j) * stride + w, &words[j], 4);
+        }
+#endif
+        for (; k < count; k++)
+        {
+            unsigned char * e = dst + (size_t) k * stride + w;
+            e[0] = p0[k];
+            e[1] = p1[k];
+            e[2] = p2[k];
+            e[3] = p3[k];
+        }
+    }
+}
+
+// elements encoded block by block, the bytes predicted from the previous element when delta is set
+static size_t encode_stream(unsigned char * dst, size_t capacity, const unsigned char * data, unsigned int count, size_t stride, int delta)
+{
+    unsigned int block = block_vertices(stride);
+    unsigned char last[CODEC_MAX_STRIDE] = { 0 };
+    unsigned char * values = (unsigned char *) malloc(block);
+    if (!values) {
+        fprintf(stderr, "Error: Memory allocation failed for mesh encoding.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned char * out = dst;
+    for (unsigned int first = 0; first < count; first += block)
+    {
+        unsigned int n = (count - first < block) ? count - first : block;
+        for (size_t b = 0; b < stride; b++)
+        {
+            if ((size_t) (dst + capacity - out) < plane_bound(n))
+            {
+                free(values);
+                return 0;
+            }
+
+            for (unsigned int k = 0; k < n; k++)
+            {
+                unsigned char byte = data[(size_t) (first + k) * stride + b];
+                values[k] = delta ? zigzag8((unsigned char) (byte - last[b])) : byte;
+                last[b] = byte;
+            }
+            out = encode_plane(out, values, n);
+        }
+    }
+
+    free(values);
+    return (size_t) (out - dst);
+}
+
+static const unsigned char * decode_stream(unsigned char * data, unsigned int count, size_t stride, const unsigned char * src, const unsigned char * end, int delta)
+{
+    unsigned int block = block_vertices(stride);
+    unsigned int pitch = block + CODEC_GROUP;
+    unsigned char last[CODEC_MAX_STRIDE] = { 0 };
+    unsigned char * planes = (unsigned char *) malloc((size_t) pitch * stride);
+    if (!planes) {
+        fprintf(stderr, "Error: Memory allocation failed for mesh decoding.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (unsigned int first = 0; src && first < count; first += block)
+    {
+        unsigned int n = (count - first < block) ? count - first : block;
+        for (size_t b = 0; src && b < stride; b++)
+        {
+            src = decode_plane(src, end, planes + b * pitch, n, delta, last[b]);
+            if (src)
+                last[b] = planes[b * pitch + n - 1];
+        }
+        if (src)
+            transpose_block(data + (size_t) first * stride, planes, pitch, n, stride);
+    }
+
+    free(planes);
+    return src;
+}
+
+size_t MeshCodec_encodeVertexBound(unsigned int n_vertices, size_t stride)
+{
+    unsigned int block = block_vertices(stride);
+    unsigned int blocks = (n_vertices + block - 1) / block;
+    return 1 + (size_t) blocks * stride * plane_bound(block);
+}
+
+size_t MeshCodec_encodeVertices(unsigned char * dst, size_t capacity, const void * vertices, unsigned int n_vertices, size_t stride)
+{
+    if (stride == 0 || stride % 4 != 0 || stride > CODEC_MAX_STRIDE) {
+        fprintf(stderr, "Error: Invalid vertex stride %u for encoding.\n", (unsigned int) stride);
+        exit(EXIT_FAILURE);
+    }
+    if (capacity < 1)
+        return 0;
+
+    dst[0] = CODEC_VERTEX_TAG;
+    size_t size = encode_stream(dst + 1, capacity - 1, (const unsigned char *) vertices, n_vertices, stride, 1);
+    return (size || n_vertices == 0) ? size + 1 : 0;
+}
+
+bool MeshCodec_decodeVertices(void * vertices, unsigned int n_vertices, size_t stride, const unsigned char * src, size_t size)
+{
+    if (stride == 0 || stride % 4 != 0 || stride > CODEC_MAX_STRIDE || size < 1 || src[0] != CODEC_VERTEX_TAG)
+        return false;
+
+    return decode_stream((unsigned char *) vertices, n_vertices, stride, src + 1, src + size, 1) != NULL;
+}
+
+static unsigned int zigzag32(unsigned int d)
+{
+    return (d << 1) ^ (unsigned int) ((int) d >> 31);
+}
+
+static unsigned int unzigzag32(unsigned int z)
+{
+    return (z >> 1) ^ (0u - (z & 1));
+}
+
+// zigzag differences of the indices with one predictor
+static void index_deltas(const unsigned int * indices, unsigned int n_indices, unsigned char predictor, unsigned int * deltas)
+{
+    unsigned int distance = predict_distances[predictor];
+    for (unsigned int k = 0; k < n_indices; k++)
+        deltas[k] = zigzag32(indices[k] - ((k >= distance) ? indices[k - distance] : 0));
+}
+
+size_t MeshCodec_encodeIndexBound(unsigned int n_indices)
+{
+    return 2 + MeshCodec_encodeVertexBound(n_indices, sizeof(unsigned int));
+}
+
+size_t MeshCodec_encodeIndices(unsigned char * dst, size_t capacity, const unsigned int * indices, unsigned int n_indices)
+{
+    if (capacity < 2)
+        return 0;
+
+    unsigned int * deltas = (unsigned int *) malloc((size_t) n_indices * sizeof(unsigned int) + sizeof(unsigned int));
+    unsigned char * trial = (unsigned char *) malloc(MeshCodec_encodeIndexBound(n_indices));
+    if (!deltas || !trial) {
+        fprintf(stderr, "Error: Memory allocation failed for index encoding.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    //every predictor tried, grids prefer the quad one and fans the previous index
+    size_t best = 0;
+    for (unsigned char predictor = PREDICT_PREVIOUS; predictor <= PREDICT_QUAD; predictor++)
+    {
+        index_deltas(indices, n_indices, predictor, deltas);
+        size_t size = encode_stream(trial, MeshCodec_encodeIndexBound(n_indices), (const unsigned char *) deltas, n_indices, sizeof(unsigned int), 0);
+        if (predictor == PREDICT_PREVIOUS || size < best)
+        {
+            best = size;
+            dst[1] = predictor;
+            if (size + 2 <= capacity)
+                memcpy(dst + 2, trial, size);
+        }
+    }
+
+    free(deltas);
+    free(trial);
+
+    if (best + 2 > capacity)
+        return 0;
+
+    dst[0] = CODEC_INDEX_TAG;
+    return best + 2;
+}
+
+bool MeshCodec_decodeIndices(unsigned int * indices, unsigned int n_indices, const unsigned char * src, size_t size)
+{
+    if (size < 2 || src[0] != CODEC_INDEX_TAG || src[1] > PREDICT_QUAD)
+        return false;
+
+    if (!decode_stream((unsigned char *) indices, n_indices, sizeof(unsigned int), src + 2, src + size, 0))
+        return false;
+
+    unsigned int distance = predict_distances[src[1]];
+    for (unsigned int k = 0; k < n_indices; k++)
+        indices[k] = unzigzag32(indices[k]) + ((k >= distance) ? indices[k - distance] : 0);
+
+    return true;
+}
\ No newline at end of file
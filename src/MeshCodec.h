@@ -0,0 +1,88 @@
+/**
+ * @file MeshCodec.h
+ * @brief Header for the mesh stream codec
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 19-10-2026
+ *
+ * Header pour la compression sans perte des sommets et des indices des fichiers de mesh
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+/**
+ * @brief vertices encoded by blocks : in each block every byte of the vertex is predicted from the same
+ * byte of the previous vertex, then the differences (zigzag) are packed by groups of 16 on 0, 2, 4 or 8 bits
+ * constant attributes (material) cost nearly nothing, quantized ones (Object_quantize) compress best
+ */
+
+/**
+ * @brief size of dst large enough for MeshCodec_encodeVertices
+ *
+ * @param n_vertices
+ * @param stride bytes per vertex, multiple of 4 and at most 256
+ * @return size_t
+ */
+size_t MeshCodec_encodeVertexBound(unsigned int n_vertices, size_t stride);
+
+/**
+ * @brief encode vertices
+ *
+ * @param dst
+ * @param capacity size of dst
+ * @param vertices
+ * @param n_vertices
+ * @param stride bytes per vertex, multiple of 4 and at most 256
+ * @return size_t bytes written, 0 if dst is too small
+ */
+size_t MeshCodec_encodeVertices(unsigned char * dst, size_t capacity, const void * vertices, unsigned int n_vertices, size_t stride);
+
+/**
+ * @brief decode vertices encoded by MeshCodec_encodeVertices (SSE2 when available)
+ *
+ * @param vertices n_vertices * stride bytes
+ * @param n_vertices
+ * @param stride
+ * @param src
+ * @param size size of src
+ * @return false if src is invalid
+ */
+bool MeshCodec_decodeVertices(void * vertices, unsigned int n_vertices, size_t stride, const unsigned char * src, size_t size);
+
+/**
+ * @brief indices encoded as zigzag differences with the previous index, the same corner of the previous triangle
+ * or of the previous quad (the smallest result), packed like the vertices on their 4 bytes
+ */
+
+/**
+ * @brief size of dst large enough for MeshCodec_encodeIndices
+ *
+ * @param n_indices
+ * @return size_t
+ */
+size_t MeshCodec_encodeIndexBound(unsigned int n_indices);
+
+/**
+ * @brief encode indices
+ *
+ * @param dst
+ * @param capacity size of dst
+ * @param indices
+ * @param n_indices multiple of 3
+ * @return size_t bytes written, 0 if dst is too small
+ */
+size_t MeshCodec_encodeIndices(unsigned char * dst, size_t capacity, const unsigned int * indices, unsigned int n_indices);
+
+/**
+ * @brief decode indices encoded by MeshCodec_encodeIndices
+ *
+ * @param indices
+ * @param n_indices
+ * @param src
+ * @param size size of src
+ * @return false if src is invalid
+ */
+bool MeshCodec_decodeIndices(unsigned int * indices, unsigned int n_indices, const unsigned char * src, size_t size);
\ No newline at end of file
@@ -1,35 +1,1994 @@
-#include "Object.h"
-#include <stdio.h>
-#include <stdlib.h>
-
-Object * Object_init(const unsigned int n_points, const unsigned char n_attributes, unsigned char * layout, const unsigned int n_faces)
-{
-    Object * obj = (Object *) calloc(1, sizeof(Object));
-    if (!obj) {
-        fprintf(stderr, "Error: Memory allocation failed for object.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    obj->n_points = n_points;
-    obj->n_attributes = n_attributes;
-    obj->n_faces = n_faces;
-    obj->layout = layout;
-
-    unsigned int size = 0;
-    for (unsigned char i = 0; i < n_attributes; i++)
-        size += layout[i];
-
-    obj->vertexBuffer = (float *) calloc(size * obj->n_points ,sizeof(float) );
-    if (!obj->vertexBuffer) {
-        fprintf(stderr, "Error: Memory allocation failed for vertex buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    obj->indexBuffer = (unsigned int *) calloc(3 * obj->n_faces ,sizeof(unsigned int) );
-    if (!obj->indexBuffer) {
-        fprintf(stderr, "Error: Memory allocation failed for index buffer array.\n");
-        exit(EXIT_FAILURE);
-    }    
-
-    return obj;
+#include "Object.h"
+#include "ThreadPool.h"
+#include "VertexFormat.hpp"
+#include "MeshCodec.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include <pthread.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+// bounds of an object whose positions are not known yet : never culled
+static void object_unbounded(Object * obj)
+{
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        obj->bounds.min[k] = -INFINITY;
+        obj->bounds.max[k] = INFINITY;
+        obj->bounds.center[k] = 0.0f;
+    }
+    obj->bounds.radius = INFINITY;
+}
+
+Object * Object_init(const unsigned int n_points, const unsigned char n_attributes, unsigned char * layout, const unsigned int n_faces)
+{
+    Arena * arena = Arena_current();
+    Object * obj = (Object *) Arena_alloc(arena, 1, sizeof(Object));
+    obj->arena = arena;
+    object_unbounded(obj);
+
+    obj->n_points = n_points;
+    obj->n_attributes = n_attributes;
+    obj->n_faces = n_faces;
+    obj->layout = layout;
+
+    unsigned int size = 0;
+    for (unsigned char i = 0; i < n_attributes; i++)
+        size += layout[i];
+
+    obj->vertexBuffer = (float *) Arena_alloc(arena, (size_t) size * obj->n_points, sizeof(float));
+    obj->indexBuffer = (unsigned int *) Arena_alloc(arena, (size_t) 3 * obj->n_faces, sizeof(unsigned int));
+
+    return obj;
+}
+
+Object * Object_initGrid(const unsigned int n_points, const unsigned char n_attributes, unsigned char * layout, GridIndices * grid)
+{
+    Arena * arena = Arena_current();
+    Object * obj = (Object *) Arena_alloc(arena, 1, sizeof(Object));
+    obj->arena = arena;
+    object_unbounded(obj);
+
+    obj->n_points = n_points;
+    obj->n_attributes = n_attributes;
+    obj->n_faces = grid->count / 3;
+    obj->layout = layout;
+    obj->grid = grid;
+    obj->indexBuffer = NULL;
+
+    unsigned int size = 0;
+    for (unsigned char i = 0; i < n_attributes; i++)
+        size += layout[i];
+
+    obj->vertexBuffer = (float *) Arena_alloc(arena, (size_t) size * obj->n_points, sizeof(float));
+
+    return obj;
+}
+
+typedef struct grid_entry
+{
+    GridIndices g;
+    struct grid_entry * next;
+} grid_entry;
+
+static grid_entry * grid_cache = NULL;
+static pthread_mutex_t grid_lock = PTHREAD_MUTEX_INITIALIZER;
+
+static void grid_set(GridIndices * g, void * data, unsigned int k, unsigned int v)
+{
+    if (g->index_size == 2)
+        ((unsigned short *) data)[k] = (unsigned short) v;
+    else
+        ((unsigned int *) data)[k] = v;
+}
+
+// same winding as the surfaces : (i, j), (i+1, j), (i+1, j+1) then (i, j), (i+1, j+1), (i, j+1)
+static void grid_generate(GridIndices * g)
+{
+    unsigned int rows = g->rows;
+    unsigned int cols = g->cols;
+    unsigned char poles = (g->wrap & GRID_POLES) != 0;
+    unsigned char wrap_cols = poles || (g->wrap & GRID_WRAP_COLS);
+
+    unsigned int row_bands = (g->wrap & GRID_WRAP_ROWS) ? rows : rows - 1;
+    unsigned int col_bands = wrap_cols ? cols : cols - 1;
+    unsigned int first = poles ? 1 : 0;
+    unsigned int last = first + rows * cols;
+
+    g->count = 6 * row_bands * col_bands + (poles ? 6 * cols : 0);
+
+    void * data = calloc(g->count, g->index_size);
+    if (!data) {
+        fprintf(stderr, "Error: Memory allocation failed for grid indices.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int k = 0;
+
+    //south pole fan on the first row
+    if (poles)
+        for (unsigned int j = 0; j < cols; j++)
+        {
+            grid_set(g, data, k++, 0);
+            grid_set(g, data, k++, first + j);
+            grid_set(g, data, k++, first + (j + 1) % cols);
+        }
+
+    for (unsigned int i = 0; i < row_bands; i++)
+    {
+        unsigned int r0 = first + i * cols;
+        unsigned int r1 = first + ((i + 1) % rows) * cols;
+
+        for (unsigned int j = 0; j < col_bands; j++)
+        {
+            unsigned int jn = (j + 1) % cols;
+
+            grid_set(g, data, k++, r0 + j);
+            grid_set(g, data, k++, r1 + j);
+            grid_set(g, data, k++, r1 + jn);
+
+            grid_set(g, data, k++, r0 + j);
+            grid_set(g, data, k++, r1 + jn);
+            grid_set(g, data, k++, r0 + jn);
+        }
+    }
+
+    //north pole fan on the last row
+    if (poles)
+        for (unsigned int j = 0; j < cols; j++)
+        {
+            grid_set(g, data, k++, last);
+            grid_set(g, data, k++, last - 1 - j);
+            grid_set(g, data, k++, last - 1 - (j + 1) % cols);
+        }
+
+    g->data = data;
+}
+
+GridIndices * Object_gridIndices(unsigned int rows, unsigned int cols, unsigned char wrap, unsigned char index_size)
+{
+    if (rows == 0 || cols == 0 || (rows < 2 && !(wrap & (GRID_WRAP_ROWS | GRID_POLES))) || (cols < 2 && !(wrap & (GRID_WRAP_COLS | GRID_POLES)))) {
+        fprintf(stderr, "Error: Invalid input arguments for grid indices.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned long long n_points = (unsigned long long) rows * cols + ((wrap & GRID_POLES) ? 2 : 0);
+    if (index_size == 0)
+        index_size = (n_points <= 65536) ? 2 : 4;
+
+    if ((index_size != 2 && index_size != 4) || (index_size == 2 && n_points > 65536)) {
+        fprintf(stderr, "Error: Invalid index size %u for %llu vertices.\n", index_size, n_points);
+        exit(EXIT_FAILURE);
+    }
+
+    pthread_mutex_lock(&grid_lock);
+
+    grid_entry * e = grid_cache;
+    while (e && !(e->g.rows == rows && e->g.cols == cols && e->g.wrap == wrap && e->g.index_size == index_size))
+        e = e->next;
+
+    if (!e)
+    {
+        e = (grid_entry *) calloc(1, sizeof(grid_entry));
+        if (!e) {
+            fprintf(stderr, "Error: Memory allocation failed for grid cache.\n");
+            exit(EXIT_FAILURE);
+        }
+        e->g.rows = rows;
+        e->g.cols = cols;
+        e->g.wrap = wrap;
+        e->g.index_size = index_size;
+        e->g.EBO = 0;
+        grid_generate(&e->g);
+        e->next = grid_cache;
+        grid_cache = e;
+    }
+
+    pthread_mutex_unlock(&grid_lock);
+    return &e->g;
+}
+
+unsigned int Object_index(const Object * obj, unsigned int i)
+{
+    if (!obj->grid)
+        return obj->indexBuffer[i];
+
+    if (obj->grid->index_size == 2)
+        return ((const unsigned short *) obj->grid->data)[i];
+
+    return ((const unsigned int *) obj->grid->data)[i];
+}
+
+unsigned int Object_attributeSize(const Object * obj, unsigned char i)
+{
+    if (!obj->types || obj->types[i] == ATTRIBUTE_FLOAT)
+        return obj->layout[i];
+
+    if (obj->types[i] == ATTRIBUTE_SNORM16)
+        return (obj->layout[i] + 1) / 2;
+
+    return 1;
+}
+
+unsigned int Object_vertexSize(const Object * obj)
+{
+    unsigned int size = 0;
+    for (unsigned char i = 0; i < obj->n_attributes; i++)
+        size += Object_attributeSize(obj, i);
+
+    return size;
+}
+
+typedef struct compact_args
+{
+    const float * src;
+    float * dst;
+} compact_args;
+
+static void object_unmap(void * mapping);
+
+static void * own_copy(const void * src, size_t size)
+{
+    void * dst = malloc(size ? size : 1);
+    if (!dst) {
+        fprintf(stderr, "Error: Memory allocation failed for object buffers.\n");
+        exit(EXIT_FAILURE);
+    }
+    memcpy(dst, src, size);
+    return dst;
+}
+
+// buffers of a loaded object copied out of its file, before they get replaced and freed
+static void object_own(Object * obj)
+{
+    if (!obj->mapping)
+        return;
+
+    obj->vertexBuffer = (float *) own_copy(obj->vertexBuffer, (size_t) obj->n_points * Object_vertexSize(obj) * sizeof(float));
+    obj->indexBuffer = (unsigned int *) own_copy(obj->indexBuffer, (size_t) 3 * obj->n_faces * sizeof(unsigned int));
+    obj->layout = (unsigned char *) own_copy(obj->layout, obj->n_attributes);
+    if (obj->types)
+        obj->types = (unsigned char *) own_copy(obj->types, obj->n_attributes);
+
+    object_unmap(obj->mapping);
+    obj->mapping = NULL;
+}
+
+static void thread_fn_compact(unsigned int begin, unsigned int end, void * args)
+{
+    compact_args * a = (compact_args *) args;
+
+    for (unsigned int i = begin; i < end; i++)
+        memcpy(a->dst + (size_t) i * VERTEX_COMPACT_SIZE, a->src + (size_t) i * VERTEX_SIZE, VERTEX_COMPACT_SIZE * sizeof(float));
+}
+
+Object * Object_compact(Object * obj)
+{
+    if (obj->compact)
+        return obj;
+
+    const unsigned char full[6] = {3, 3, 3, 3, 1, 1};
+    if (obj->types || obj->n_attributes != 6 || memcmp(obj->layout, full, 6) != 0 || obj->n_points == 0) {
+        fprintf(stderr, "Error: Only float objects with the 14 floats layout can be compacted.\n");
+        exit(EXIT_FAILURE);
+    }
+    object_own(obj);
+
+    const float * v = obj->vertexBuffer;
+    memcpy(obj->material.color, v + 6, 3 * sizeof(float));
+    memcpy(obj->material.specular, v + 9, 3 * sizeof(float));
+    obj->material.shininess = v[12];
+    obj->material.reflection = v[13];
+
+    float * vertices = (float *) Arena_alloc(obj->arena, (size_t) obj->n_points * VERTEX_COMPACT_SIZE, sizeof(float));
+
+    compact_args args;
+    args.src = obj->vertexBuffer;
+    args.dst = vertices;
+    ThreadPool_parallelFor(0, obj->n_points, 16384, thread_fn_compact, (void *) &args);
+
+    Arena_release(obj->arena, obj->vertexBuffer);
+    obj->vertexBuffer = vertices;
+    obj->n_attributes = 2;      //position and normal, the layout keeps its first two entries
+    obj->compact = 1;
+
+    return obj;
+}
+
+typedef struct quantize_args
+{
+    const float * src;
+    float * dst;
+    unsigned int src_size;
+    unsigned int dst_size;
+    unsigned char compact;
+    float center[3];
+    float inv_scale;
+} quantize_args;
+
+static short snorm16(float x)
+{
+    x = (x < -1.0f) ? -1.0f : ((x > 1.0f) ? 1.0f : x);
+    return (short) lrintf(x * 32767.0f);
+}
+
+static unsigned char unorm8(float x)
+{
+    x = (x < 0.0f) ? 0.0f : ((x > 1.0f) ? 1.0f : x);
+    return (unsigned char) lrintf(x * 255.0f);
+}
+
+// the unit sphere is projected on the octahedron |x| + |y| + |z| = 1, the lower half is folded over the upper one
+static void oct_encode(const float * n, short * e)
+{
+    float l1 = fabsf(n[0]) + fabsf(n[1]) + fabsf(n[2]);
+    float x = (l1 > 0.0f) ? n[0] / l1 : 0.0f;
+    float y = (l1 > 0.0f) ? n[1] / l1 : 0.0f;
+
+    if (n[2] < 0.0f)
+    {
+        float fx = (1.0f - fabsf(y)) * ((x >= 0.0f) ? 1.0f : -1.0f);
+        float fy = (1.0f - fabsf(x)) * ((y >= 0.0f) ? 1.0f : -1.0f);
+        x = fx;
+        y = fy;
+    }
+
+    e[0] = snorm16(x);
+    e[1] = snorm16(y);
+}
+
+static void thread_fn_quantize(unsigned int begin, unsigned int end, void * args)
+{
+    quantize_args * a = (quantize_args *) args;
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        const float * v = a->src + (size_t) i * a->src_size;
+        float * dst = a->dst + (size_t) i * a->dst_size;
+
+        short position[3], normal[2];
+        for (unsigned char k = 0; k < 3; k++)
+            position[k] = snorm16((v[k] - a->center[k]) * a->inv_scale);
+        oct_encode(v + 3, normal);
+
+        if (a->compact)
+        {
+            QuantizedCompactVertexFormat::Vertex * q = (QuantizedCompactVertexFormat::Vertex *) dst;
+            q->copy<0>(position);
+            q->copy<1>(normal);
+            continue;
+        }
+
+        QuantizedVertexFormat::Vertex * q = (QuantizedVertexFormat::Vertex *) dst;
+        q->copy<0>(position);
+        q->copy<1>(normal);
+        q->set<2>(unorm8(v[6]), unorm8(v[7]), unorm8(v[8]));
+        q->set<3>(unorm8(v[9]), unorm8(v[10]), unorm8(v[11]));
+        q->set<4>(v[12]);
+        q->set<5>(v[13]);
+    }
+}
+
+Object * Object_quantize(Object * obj)
+{
+    if (obj->types)
+        return obj;
+
+    const unsigned char full[6] = {3, 3, 3, 3, 1, 1};
+    unsigned char n_attributes = obj->compact ? 2 : 6;
+    if (obj->n_attributes != n_attributes || memcmp(obj->layout, full, n_attributes) != 0 || obj->n_points == 0) {
+        fprintf(stderr, "Error: Only objects with the 14 floats or the compact layout can be quantized.\n");
+        exit(EXIT_FAILURE);
+    }
+    object_own(obj);
+
+    unsigned int src_size = Object_vertexSize(obj);
+
+    //bounding cube : one scale for the three axis keeps the normal matrix of the model valid
+    float min[3], max[3];
+    for (unsigned char k = 0; k < 3; k++)
+        min[k] = max[k] = obj->vertexBuffer[k];
+
+    for (unsigned int i = 1; i < obj->n_points; i++)
+    {
+        const float * v = obj->vertexBuffer + (size_t) i * src_size;
+        for (unsigned char k = 0; k < 3; k++)
+        {
+            min[k] = (v[k] < min[k]) ? v[k] : min[k];
+            max[k] = (v[k] > max[k]) ? v[k] : max[k];
+        }
+    }
+
+    quantize_args args;
+    float scale = 0.0f;
+    for (unsigned char k = 0; k < 3; k++)
+    {
+        args.center[k] = 0.5f * (min[k] + max[k]);
+        scale = (0.5f * (max[k] - min[k]) > scale) ? 0.5f * (max[k] - min[k]) : scale;
+    }
+    if (scale == 0.0f)
+        scale = 1.0f;
+
+    obj->types = (unsigned char *) Arena_alloc(obj->arena, n_attributes, sizeof(unsigned char));
+    obj->types[0] = ATTRIBUTE_SNORM16;
+    obj->types[1] = ATTRIBUTE_OCT16;
+    if (!obj->compact)
+    {
+        obj->types[2] = ATTRIBUTE_UNORM8;
+        obj->types[3] = ATTRIBUTE_UNORM8;
+    }
+
+    args.src = obj->vertexBuffer;
+    args.src_size = src_size;
+    args.dst_size = Object_vertexSize(obj);
+    args.compact = obj->compact;
+    args.inv_scale = 1.0f / scale;
+
+    args.dst = (float *) Arena_alloc(obj->arena, (size_t) obj->n_points * args.dst_size, sizeof(float));   //the padding stays 0
+
+    ThreadPool_parallelFor(0, obj->n_points, 16384, thread_fn_quantize, (void *) &args);
+
+    Arena_release(obj->arena, obj->vertexBuffer);
+    obj->vertexBuffer = args.dst;
+
+    obj->dequantization[0] = args.center[0];
+    obj->dequantization[1] = args.center[1];
+    obj->dequantization[2] = args.center[2];
+    obj->dequantization[3] = scale;
+
+    //the rounding moves a position by at most one step on each axis
+    float step = scale / 32767.0f;
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        obj->bounds.min[k] -= step;
+        obj->bounds.max[k] += step;
+    }
+    obj->bounds.radius += 1.7320508f * step;
+
+    return obj;
+}
+
+//ACMR of indices with a FIFO cache : a vertex stays in it for the cache_size next misses
+static float fifo_acmr(const unsigned int * indices, unsigned int n_indices, unsigned int n_vertices, unsigned int cache_size)
+{
+    if (n_indices < 3)
+        return 0.0f;
+
+    unsigned int * inserted = (unsigned int *) malloc((size_t) n_vertices * sizeof(unsigned int));
+    if (!inserted) {
+        fprintf(stderr, "Error: Memory allocation failed for cache simulation.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(inserted, 0xff, (size_t) n_vertices * sizeof(unsigned int));
+
+    unsigned int misses = 0;
+    for (unsigned int k = 0; k < n_indices; k++)
+    {
+        unsigned int v = indices[k];
+        if (inserted[v] != 0xffffffffu && misses - inserted[v] <= cache_size)
+            continue;
+
+        inserted[v] = misses;
+        misses++;
+    }
+
+    free(inserted);
+    return (float) misses / (float) (n_indices / 3);
+}
+
+float Object_acmr(const Object * obj, unsigned int cache_size)
+{
+    unsigned int n_indices = 3 * obj->n_faces;
+    if (!obj->grid)
+        return fifo_acmr(obj->indexBuffer, n_indices, obj->n_points, cache_size);
+
+    unsigned int * indices = (unsigned int *) malloc((size_t) n_indices * sizeof(unsigned int));
+    if (!indices) {
+        fprintf(stderr, "Error: Memory allocation failed for cache simulation.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (unsigned int k = 0; k < n_indices; k++)
+        indices[k] = Object_index(obj, k);
+
+    float acmr = fifo_acmr(indices, n_indices, obj->n_points, cache_size);
+    free(indices);
+    return acmr;
+}
+
+typedef struct index_cluster
+{
+    float key;
+    unsigned int first;     //first triangle
+    unsigned int count;
+} index_cluster;
+
+static int cluster_compare(const void * a, const void * b)
+{
+    float ka = ((const index_cluster *) a)->key;
+    float kb = ((const index_cluster *) b)->key;
+    return (ka < kb) - (ka > kb);
+}
+
+// Tipsify (Sander, Nehab, Barczak 2007) : fan the triangles around a vertex, then go on with the vertex
+// of the fan that will still be in the cache, clusters start where the walk had to jump to an uncached vertex
+static unsigned int tipsify(const unsigned int * in, unsigned int n_tris, unsigned int n_vertices, unsigned int cache_size,
+ unsigned int * out, unsigned int * cluster_starts)
+{
+    unsigned int * offsets = (unsigned int *) calloc((size_t) n_vertices + 1, sizeof(unsigned int));
+    unsigned int * adjacency = (unsigned int *) malloc((size_t) 3 * n_tris * sizeof(unsigned int));
+    unsigned int * live = (unsigned int *) calloc(n_vertices, sizeof(unsigned int));
+    unsigned int * cache_time = (unsigned int *) calloc(n_vertices, sizeof(unsigned int));
+    unsigned int * dead_end = (unsigned int *) malloc((size_t) 3 * n_tris * sizeof(unsigned int));
+    unsigned char * emitted = (unsigned char *) calloc(n_tris, sizeof(unsigned char));
+    if (!offsets || !adjacency || !live || !cache_time || !dead_end || !emitted) {
+        fprintf(stderr, "Error: Memory allocation failed for index optimization.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    //triangles around each vertex
+    for (unsigned int k = 0; k < 3 * n_tris; k++)
+        live[in[k]]++;
+
+    unsigned int max_degree = 0;
+    for (unsigned int v = 0; v < n_vertices; v++)
+    {
+        offsets[v + 1] = offsets[v] + live[v];
+        max_degree = (live[v] > max_degree) ? live[v] : max_degree;
+    }
+
+    for (unsigned int t = 0; t < n_tris; t++)
+        for (unsigned int c = 0; c < 3; c++)
+            adjacency[offsets[in[3 * t + c]]++] = t;
+
+    for (unsigned int v = n_vertices; v > 0; v--)
+        offsets[v] = offsets[v - 1];
+    offsets[0] = 0;
+
+    unsigned int * candidates = (unsigned int *) malloc((size_t) 3 * max_degree * sizeof(unsigned int) + sizeof(unsigned int));
+    if (!candidates) {
+        fprintf(stderr, "Error: Memory allocation failed for index optimization.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int timestamp = cache_size + 1;
+    unsigned int cursor = 0;
+    unsigned int n_dead = 0;
+    unsigned int n_out = 0;
+    unsigned int n_clusters = 1;
+    cluster_starts[0] = 0;
+
+    long long fan = (n_vertices > 0) ? 0 : -1;
+    while (fan >= 0)
+    {
+        unsigned int f = (unsigned int) fan;
+        unsigned int n_candidates = 0;
+
+        for (unsigned int j = offsets[f]; j < offsets[f + 1]; j++)
+        {
+            unsigned int t = adjacency[j];
+            if (emitted[t])
+                continue;
+            emitted[t] = 1;
+
+            for (unsigned int c = 0; c < 3; c++)
+            {
+                unsigned int v = in[3 * t + c];
+                out[3 * n_out + c] = v;
+                dead_end[n_dead++] = v;
+                candidates[n_candidates++] = v;
+                live[v]--;
+
+                if (timestamp - cache_time[v] > cache_size)
+                    cache_time[v] = timestamp++;
+            }
+            n_out++;
+        }
+
+        //the oldest vertex of the fan that is still cached after its own remaining triangles
+        fan = -1;
+        int best = -1;
+        for (unsigned int k = 0; k < n_candidates; k++)
+        {
+            unsigned int v = candidates[k];
+            if (live[v] == 0)
+                continue;
+
+            int priority = 0;
+            if (timestamp - cache_time[v] + 2 * live[v] <= cache_size)
+                priority = (int) (timestamp - cache_time[v]);
+
+            if (priority > best)
+            {
+                best = priority;
+                fan = v;
+            }
+        }
+
+        if (fan >= 0)
+            continue;
+
+        //dead end : a recent vertex with triangles left, or the next one in order
+        while (n_dead > 0 && fan < 0)
+        {
+            unsigned int v = dead_end[--n_dead];
+            if (live[v] > 0)
+                fan = v;
+        }
+
+        while (fan < 0 && cursor < n_vertices)
+        {
+            if (live[cursor] > 0)
+                fan = cursor;
+            cursor++;
+        }
+
+        if (fan >= 0 && timestamp - cache_time[fan] > cache_size && n_out > cluster_starts[n_clusters - 1])
+            cluster_starts[n_clusters++] = n_out;
+    }
+
+    free(offsets);
+    free(adjacency);
+    free(live);
+    free(cache_time);
+    free(dead_end);
+    free(emitted);
+    free(candidates);
+
+    return n_clusters;
+}
+
+static void vertex_position(const Object * obj, unsigned int v, float * p)
+{
+    const float * vertex = obj->vertexBuffer + (size_t) v * Object_vertexSize(obj);
+
+    if (obj->types && obj->types[0] == ATTRIBUTE_SNORM16)
+    {
+        //quantized positions are an affine transform with a uniform scale, their order is the same
+        short q[3];
+        memcpy(q, vertex, sizeof(q));
+        p[0] = q[0];
+        p[1] = q[1];
+        p[2] = q[2];
+        return;
+    }
+
+    p[0] = vertex[0];
+    p[1] = vertex[1];
+    p[2] = vertex[2];
+}
+
+// position of the vertex v in the space of the object, quantized positions are dequantized
+static void object_position(const Object * obj, unsigned int v, float * p)
+{
+    vertex_position(obj, v, p);
+    if (obj->types && obj->types[0] == ATTRIBUTE_SNORM16)
+        for (unsigned int k = 0; k < 3; k++)
+            p[k] = obj->dequantization[k] + obj->dequantization[3] * fmaxf(p[k] / 32767.0f, -1.0f);
+}
+
+// bounding box of the positions, dequantized for a quantized object
+static void object_bounds(const Object * obj, float * bounds)
+{
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        bounds[k] = (obj->n_points > 0) ? INFINITY : 0.0f;
+        bounds[3 + k] = (obj->n_points > 0) ? -INFINITY : 0.0f;
+    }
+
+    for (unsigned int v = 0; v < obj->n_points; v++)
+    {
+        float p[3];
+        object_position(obj, v, p);
+        for (unsigned int k = 0; k < 3; k++)
+        {
+            bounds[k] = (p[k] < bounds[k]) ? p[k] : bounds[k];
+            bounds[3 + k] = (p[k] > bounds[3 + k]) ? p[k] : bounds[3 + k];
+        }
+    }
+}
+
+void Object_setBounds(Object * obj, const float * min, const float * max, float radius)
+{
+    float d2 = 0.0f;
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        obj->bounds.min[k] = min[k];
+        obj->bounds.max[k] = max[k];
+        obj->bounds.center[k] = 0.5f * (min[k] + max[k]);
+        d2 += 0.25f * (max[k] - min[k]) * (max[k] - min[k]);
+    }
+    obj->bounds.radius = (radius > 0.0f) ? radius : sqrtf(d2);
+}
+
+void Object_growBounds(Object * obj, const float * min, const float * max)
+{
+    //unknown bounds stay unknown, a box already inside keeps the sphere (possibly tighter than the box)
+    if (!isfinite(obj->bounds.radius))
+        return;
+
+    unsigned char inside = 1;
+    for (unsigned int k = 0; k < 3; k++)
+        if (min[k] < obj->bounds.min[k] || max[k] > obj->bounds.max[k])
+            inside = 0;
+    if (inside)
+        return;
+
+    float box_min[3], box_max[3];
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        box_min[k] = fminf(min[k], obj->bounds.min[k]);
+        box_max[k] = fmaxf(max[k], obj->bounds.max[k]);
+    }
+    Object_setBounds(obj, box_min, box_max, 0.0f);
+}
+
+void Object_computeBounds(Object * obj)
+{
+    float box[6];
+    object_bounds(obj, box);
+    Object_setBounds(obj, box, box + 3, 0.0f);
+
+    //the farthest vertex from the center of the box, tighter than its half diagonal
+    float r2 = 0.0f;
+    for (unsigned int v = 0; v < obj->n_points; v++)
+    {
+        float p[3];
+        object_position(obj, v, p);
+        float dx = p[0] - obj->bounds.center[0];
+        float dy = p[1] - obj->bounds.center[1];
+        float dz = p[2] - obj->bounds.center[2];
+        float d2 = dx * dx + dy * dy + dz * dz;
+        r2 = (d2 > r2) ? d2 : r2;
+    }
+    obj->bounds.radius = sqrtf(r2);
+}
+
+// clusters whose triangles face away from the center of the object are drawn first, they occlude the others
+static void sort_clusters(const Object * obj, unsigned int * indices, const unsigned int * cluster_starts, unsigned int n_clusters, unsigned int n_tris)
+{
+    index_cluster * clusters = (index_cluster *) malloc((size_t) n_clusters * sizeof(index_cluster));
+    unsigned int * sorted = (unsigned int *) malloc((size_t) 3 * n_tris * sizeof(unsigned int));
+    if (!clusters || !sorted) {
+        fprintf(stderr, "Error: Memory allocation failed for index optimization.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    double center[3] = {0.0, 0.0, 0.0};
+    for (unsigned int v = 0; v < obj->n_points; v++)
+    {
+        float p[3];
+        vertex_position(obj, v, p);
+        center[0] += p[0];
+        center[1] += p[1];
+        center[2] += p[2];
+    }
+    for (unsigned int k = 0; k < 3; k++)
+        center[k] /= (obj->n_points > 0) ? obj->n_points : 1;
+
+    for (unsigned int c = 0; c < n_clusters; c++)
+    {
+        clusters[c].first = cluster_starts[c];
+        clusters[c].count = ((c + 1 < n_clusters) ? cluster_starts[c + 1] : n_tris) - cluster_starts[c];
+
+        //area weighted centroid and normal of the cluster
+        double centroid[3] = {0.0, 0.0, 0.0}, normal[3] = {0.0, 0.0, 0.0}, area = 0.0;
+        for (unsigned int t = clusters[c].first; t < clusters[c].first + clusters[c].count; t++)
+        {
+            float a[3], b[3], d[3];
+            vertex_position(obj, indices[3 * t + 0], a);
+            vertex_position(obj, indices[3 * t + 1], b);
+            vertex_position(obj, indices[3 * t + 2], d);
+
+            double e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+            double e2[3] = {d[0] - a[0], d[1] - a[1], d[2] - a[2]};
+            double n[3] = {e1[1] * e2[2] - e1[2] * e2[1], e1[2] * e2[0] - e1[0] * e2[2], e1[0] * e2[1] - e1[1] * e2[0]};
+            double w = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+
+            for (unsigned int k = 0; k < 3; k++)
+            {
+                centroid[k] += w * (a[k] + b[k] + d[k]) / 3.0;
+                normal[k] += n[k];
+            }
+            area += w;
+        }
+
+        double key = 0.0;
+        if (area > 0.0)
+            for (unsigned int k = 0; k < 3; k++)
+                key += (centroid[k] / area - center[k]) * normal[k];
+        clusters[c].key = (float) key;
+    }
+
+    qsort(clusters, n_clusters, sizeof(index_cluster), cluster_compare);
+
+    unsigned int n = 0;
+    for (unsigned int c = 0; c < n_clusters; c++)
+    {
+        memcpy(sorted + 3 * n, indices + 3 * clusters[c].first, (size_t) 3 * clusters[c].count * sizeof(unsigned int));
+        n += clusters[c].count;
+    }
+    memcpy(indices, sorted, (size_t) 3 * n_tris * sizeof(unsigned int));
+
+    free(clusters);
+    free(sorted);
+}
+
+// renumber the vertices in order of first use, unused vertices go at the end
+static void reorder_vertices(Object * obj, unsigned int * indices, unsigned int n_indices)
+{
+    unsigned int size = Object_vertexSize(obj);
+    unsigned int * remap = (unsigned int *) malloc((size_t) obj->n_points * sizeof(unsigned int));
+    float * vertices = (float *) Arena_alloc(obj->arena, (size_t) obj->n_points * size, sizeof(float));
+    if (!remap) {
+        fprintf(stderr, "Error: Memory allocation failed for vertex reordering.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(remap, 0xff, (size_t) obj->n_points * sizeof(unsigned int));
+
+    unsigned int next = 0;
+    for (unsigned int k = 0; k < n_indices; k++)
+    {
+        if (remap[indices[k]] == 0xffffffffu)
+            remap[indices[k]] = next++;
+        indices[k] = remap[indices[k]];
+    }
+
+    for (unsigned int v = 0; v < obj->n_points; v++)
+    {
+        if (remap[v] == 0xffffffffu)
+            remap[v] = next++;
+        memcpy(vertices + (size_t) remap[v] * size, obj->vertexBuffer + (size_t) v * size, size * sizeof(float));
+    }
+
+    Arena_release(obj->arena, obj->vertexBuffer);
+    obj->vertexBuffer = vertices;
+    free(remap);
+}
+
+void Object_optimizeIndices(Object * obj, unsigned int cache_size, unsigned char overdraw, float * acmr_before, float * acmr_after)
+{
+    unsigned int n_tris = obj->n_faces;
+    unsigned int n_indices = 3 * n_tris;
+    if (cache_size < 3) {
+        fprintf(stderr, "Error: Invalid cache size %u.\n", cache_size);
+        exit(EXIT_FAILURE);
+    }
+    object_own(obj);
+
+    //the object gets its own indices, the shared ones stay as they are
+    unsigned int * indices = (unsigned int *) malloc((size_t) n_indices * sizeof(unsigned int) + sizeof(unsigned int));
+    unsigned int * cluster_starts = (unsigned int *) malloc((size_t) n_tris * sizeof(unsigned int) + sizeof(unsigned int));
+    if (!indices || !cluster_starts) {
+        fprintf(stderr, "Error: Memory allocation failed for index optimization.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (unsigned int k = 0; k < n_indices; k++)
+        indices[k] = Object_index(obj, k);
+
+    if (acmr_before)
+        *acmr_before = fifo_acmr(indices, n_indices, obj->n_points, cache_size);
+
+    unsigned int * optimized = (unsigned int *) Arena_alloc(obj->arena, n_indices, sizeof(unsigned int));
+
+    unsigned int n_clusters = tipsify(indices, n_tris, obj->n_points, cache_size, optimized, cluster_starts);
+    free(indices);
+
+    if (overdraw && n_clusters > 1)
+        sort_clusters(obj, optimized, cluster_starts, n_clusters, n_tris);
+    free(cluster_starts);
+
+    reorder_vertices(obj, optimized, n_indices);
+
+    Arena_release(obj->arena, obj->indexBuffer);
+    obj->indexBuffer = optimized;
+    obj->grid = NULL;
+
+    if (acmr_after)
+        *acmr_after = fifo_acmr(optimized, n_indices, obj->n_points, cache_size);
+}
+
+//symmetric 4x4 matrix of a quadric : a00 a01 a02 a11 a12 a22, b0 b1 b2, c
+typedef struct quadric
+{
+    double a[6];
+    double b[3];
+    double c;
+} quadric;
+
+typedef struct collapse
+{
+    float cost;
+    unsigned int from, to;
+    unsigned int version_from, version_to;
+} collapse;
+
+typedef struct collapse_heap
+{
+    collapse * data;
+    size_t count, capacity;
+} collapse_heap;
+
+static void quadric_plane(quadric * q, double nx, double ny, double nz, double d)
+{
+    q->a[0] += nx * nx; q->a[1] += nx * ny; q->a[2] += nx * nz;
+    q->a[3] += ny * ny; q->a[4] += ny * nz; q->a[5] += nz * nz;
+    q->b[0] += nx * d; q->b[1] += ny * d; q->b[2] += nz * d;
+    q->c += d * d;
+}
+
+static double quadric_error(const quadric * q, const quadric * r, const float * p)
+{
+    double a[6], b[3];
+    for (unsigned int k = 0; k < 6; k++)
+        a[k] = q->a[k] + r->a[k];
+    for (unsigned int k = 0; k < 3; k++)
+        b[k] = q->b[k] + r->b[k];
+
+    double x = p[0], y = p[1], z = p[2];
+    double e = a[0] * x * x + a[3] * y * y + a[5] * z * z + 2.0 * (a[1] * x * y + a[2] * x * z + a[4] * y * z)
+     + 2.0 * (b[0] * x + b[1] * y + b[2] * z) + q->c + r->c;
+
+    return (e > 0.0) ? e : 0.0;
+}
+
+static void heap_push(collapse_heap * h, collapse c)
+{
+    if (h->count == h->capacity)
+    {
+        h->capacity = h->capacity ? 2 * h->capacity : 1024;
+        h->data = (collapse *) realloc(h->data, h->capacity * sizeof(collapse));
+        if (!h->data) {
+            fprintf(stderr, "Error: Memory allocation failed for simplification.\n");
+            exit(EXIT_FAILURE);
+        }
+    }
+
+    size_t i = h->count++;
+    while (i > 0 && h->data[(i - 1) / 2].cost > c.cost)
+    {
+        h->data[i] = h->data[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    h->data[i] = c;
+}
+
+static collapse heap_pop(collapse_heap * h)
+{
+    collapse top = h->data[0];
+    collapse last = h->data[--h->count];
+
+    size_t i = 0;
+    for (;;)
+    {
+        size_t child = 2 * i + 1;
+        if (child >= h->count)
+            break;
+        if (child + 1 < h->count && h->data[child + 1].cost < h->data[child].cost)
+            child++;
+        if (h->data[child].cost >= last.cost)
+            break;
+        h->data[i] = h->data[child];
+        i = child;
+    }
+    if (h->count > 0)
+        h->data[i] = last;
+
+    return top;
+}
+
+typedef struct simplifier
+{
+    unsigned int n_vertices, n_tris;
+    float * positions;              //3 per vertex
+    unsigned int * indices;
+    unsigned char * dead_tris;
+    quadric * quadrics;
+    unsigned char * locked;
+    unsigned char * removed;
+    unsigned int * versions;
+    unsigned int * heads, * tails;  //triangles around each vertex, linked lists of nodes
+    unsigned int * node_tri, * node_next;
+    unsigned int * marks;
+    unsigned int mark;
+    collapse_heap heap;
+} simplifier;
+
+#define SIMPLIFY_NONE 0xffffffffu
+
+typedef struct sorted_position
+{
+    float p[3];
+    unsigned int v;
+} sorted_position;
+
+static int position_compare(const void * a, const void * b)
+{
+    const float * pa = ((const sorted_position *) a)->p;
+    const float * pb = ((const sorted_position *) b)->p;
+    for (unsigned int k = 0; k < 3; k++)
+        if (pa[k] != pb[k])
+            return (pa[k] < pb[k]) ? -1 : 1;
+    return 0;
+}
+
+static void triangle_normal(const float * a, const float * b, const float * c, double * n)
+{
+    double e1[3] = {b[0] - a[0], b[1] - a[1], b[2] - a[2]};
+    double e2[3] = {c[0] - a[0], c[1] - a[1], c[2] - a[2]};
+    n[0] = e1[1] * e2[2] - e1[2] * e2[1];
+    n[1] = e1[2] * e2[0] - e1[0] * e2[2];
+    n[2] = e1[0] * e2[1] - e1[1] * e2[0];
+}
+
+// cheapest direction of the edge (u, w) pushed on the heap, nothing if both ends are locked
+static void simplifier_push(simplifier * s, unsigned int u, unsigned int w)
+{
+    double cost_uw = s->locked[u] ? -1.0 : quadric_error(&s->quadrics[u], &s->quadrics[w], s->positions + 3 * (size_t) w);
+    double cost_wu = s->locked[w] ? -1.0 : quadric_error(&s->quadrics[u], &s->quadrics[w], s->positions + 3 * (size_t) u);
+    if (cost_uw < 0.0 && cost_wu < 0.0)
+        return;
+
+    collapse c;
+    if (cost_wu < 0.0 || (cost_uw >= 0.0 && cost_uw <= cost_wu))
+    {
+        c.cost = (float) cost_uw;
+        c.from = u;
+        c.to = w;
+    }
+    else
+    {
+        c.cost = (float) cost_wu;
+        c.from = w;
+        c.to = u;
+    }
+    c.version_from = s->versions[c.from];
+    c.version_to = s->versions[c.to];
+    heap_push(&s->heap, c);
+}
+
+// the collapse keeps the surface a manifold (two common neighbors at most) and does not fold a triangle
+static bool simplifier_valid(simplifier * s, unsigned int from, unsigned int to)
+{
+    s->mark++;
+    for (unsigned int n = s->heads[from]; n != SIMPLIFY_NONE; n = s->node_next[n])
+    {
+        unsigned int t = s->node_tri[n];
+        if (s->dead_tris[t])
+            continue;
+        for (unsigned int c = 0; c < 3; c++)
+            s->marks[s->indices[3 * t + c]] = s->mark;
+    }
+
+    s->mark++;
+    unsigned int common = 0;
+    for (unsigned int n = s->heads[to]; n != SIMPLIFY_NONE; n = s->node_next[n])
+    {
+        unsigned int t = s->node_tri[n];
+        if (s->dead_tris[t])
+            continue;
+        for (unsigned int c = 0; c < 3; c++)
+        {
+            unsigned int v = s->indices[3 * t + c];
+            if (v == from || v == to || s->marks[v] != s->mark - 1)
+                continue;
+            s->marks[v] = s->mark;
+            common++;
+        }
+    }
+    if (common > 2)
+        return false;
+
+    for (unsigned int n = s->heads[from]; n != SIMPLIFY_NONE; n = s->node_next[n])
+    {
+        unsigned int t = s->node_tri[n];
+        const unsigned int * tri = s->indices + 3 * t;
+        if (s->dead_tris[t] || tri[0] == to || tri[1] == to || tri[2] == to)
+            continue;
+
+        const float * p[3], * q[3];
+        for (unsigned int c = 0; c < 3; c++)
+        {
+            p[c] = s->positions + 3 * (size_t) tri[c];
+            q[c] = (tri[c] == from) ? s->positions + 3 * (size_t) to : p[c];
+        }
+
+        double before[3], after[3];
+        triangle_normal(p[0], p[1], p[2], before);
+        triangle_normal(q[0], q[1], q[2], after);
+        //more than 75 degrees of rotation is a fold in the making
+        double dot = before[0] * after[0] + before[1] * after[1] + before[2] * after[2];
+        double lengths = (before[0] * before[0] + before[1] * before[1] + before[2] * before[2])
+         * (after[0] * after[0] + after[1] * after[1] + after[2] * after[2]);
+        if (dot <= 0.0 || dot * dot < 0.067 * lengths)
+            return false;
+    }
+
+    return true;
+}
+
+static unsigned int simplifier_collapse(simplifier * s, unsigned int from, unsigned int to)
+{
+    unsigned int removed = 0;
+    for (unsigned int n = s->heads[from]; n != SIMPLIFY_NONE; n = s->node_next[n])
+    {
+        unsigned int t = s->node_tri[n];
+        if (s->dead_tris[t])
+            continue;
+
+        unsigned int * tri = s->indices + 3 * t;
+        if (tri[0] == to || tri[1] == to || tri[2] == to)
+        {
+            s->dead_tris[t] = 1;
+            removed++;
+            continue;
+        }
+        for (unsigned int c = 0; c < 3; c++)
+            if (tri[c] == from)
+                tri[c] = to;
+    }
+
+    //the triangles of from now belong to to
+    if (s->heads[from] != SIMPLIFY_NONE)
+    {
+        if (s->heads[to] == SIMPLIFY_NONE)
+            s->heads[to] = s->heads[from];
+        else
+            s->node_next[s->tails[to]] = s->heads[from];
+        s->tails[to] = s->tails[from];
+    }
+    s->heads[from] = SIMPLIFY_NONE;
+
+    for (unsigned int k = 0; k < 6; k++)
+        s->quadrics[to].a[k] += s->quadrics[from].a[k];
+    for (unsigned int k = 0; k < 3; k++)
+        s->quadrics[to].b[k] += s->quadrics[from].b[k];
+    s->quadrics[to].c += s->quadrics[from].c;
+
+    s->removed[from] = 1;
+    s->versions[to]++;
+
+    for (unsigned int n = s->heads[to]; n != SIMPLIFY_NONE; n = s->node_next[n])
+    {
+        unsigned int t = s->node_tri[n];
+        if (s->dead_tris[t])
+            continue;
+        for (unsigned int c = 0; c < 3; c++)
+            if (s->indices[3 * t + c] != to)
+                simplifier_push(s, to, s->indices[3 * t + c]);
+    }
+
+    return removed;
+}
+
+// vertices on an edge used by a single triangle (or more than two), and vertices at the same position as others
+static void simplifier_lock(simplifier * s)
+{
+    //edges counted from both of their vertices : an edge (a, b) of a triangle is used once more by its opposite
+    for (unsigned int v = 0; v < s->n_vertices; v++)
+    {
+        s->mark++;
+        for (unsigned int n = s->heads[v]; n != SIMPLIFY_NONE; n = s->node_next[n])
+        {
+            const unsigned int * tri = s->indices + 3 * s->node_tri[n];
+            for (unsigned int c = 0; c < 3; c++)
+            {
+                if (tri[c] == v)
+                    continue;
+                unsigned int w = tri[c];
+                //marks count the triangles sharing (v, w) : mark for one, mark + 1 for two, mark + 2 for more
+                if (s->marks[w] < s->mark)
+                    s->marks[w] = s->mark;
+                else if (s->marks[w] < s->mark + 2)
+                    s->marks[w]++;
+            }
+        }
+        for (unsigned int n = s->heads[v]; n != SIMPLIFY_NONE; n = s->node_next[n])
+        {
+            const unsigned int * tri = s->indices + 3 * s->node_tri[n];
+            for (unsigned int c = 0; c < 3; c++)
+                if (tri[c] != v && s->marks[tri[c]] != s->mark + 1)
+                    s->locked[v] = 1;
+        }
+        s->mark += 2;
+    }
+
+    sorted_position * order = (sorted_position *) malloc((size_t) s->n_vertices * sizeof(sorted_position) + sizeof(sorted_position));
+    if (!order) {
+        fprintf(stderr, "Error: Memory allocation failed for simplification.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (unsigned int v = 0; v < s->n_vertices; v++)
+    {
+        memcpy(order[v].p, s->positions + 3 * (size_t) v, 3 * sizeof(float));
+        order[v].v = v;
+    }
+
+    qsort(order, s->n_vertices, sizeof(sorted_position), position_compare);
+
+    for (unsigned int k = 1; k < s->n_vertices; k++)
+        if (position_compare(&order[k - 1], &order[k]) == 0)
+            s->locked[order[k - 1].v] = s->locked[order[k].v] = 1;
+
+    free(order);
+}
+
+static void * simplify_alloc(size_t count, size_t size)
+{
+    void * p = calloc(count ? count : 1, size);
+    if (!p) {
+        fprintf(stderr, "Error: Memory allocation failed for simplification.\n");
+        exit(EXIT_FAILURE);
+    }
+    return p;
+}
+
+Object * Object_simplify(const Object * obj, float target_ratio, float max_error)
+{
+    if (obj->types && obj->types[0] != ATTRIBUTE_FLOAT) {
+        fprintf(stderr, "Error: Cannot simplify an object with quantized positions.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (target_ratio < 0.0f || target_ratio > 1.0f || max_error < 0.0f) {
+        fprintf(stderr, "Error: Invalid input arguments for simplification.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    simplifier s;
+    memset(&s, 0, sizeof(simplifier));
+    s.n_vertices = obj->n_points;
+    s.n_tris = obj->n_faces;
+
+    unsigned int size = Object_vertexSize(obj);
+    s.positions = (float *) simplify_alloc((size_t) 3 * s.n_vertices, sizeof(float));
+    for (unsigned int v = 0; v < s.n_vertices; v++)
+        memcpy(s.positions + 3 * (size_t) v, obj->vertexBuffer + (size_t) v * size, 3 * sizeof(float));
+
+    s.indices = (unsigned int *) simplify_alloc((size_t) 3 * s.n_tris, sizeof(unsigned int));
+    for (unsigned int k = 0; k < 3 * s.n_tris; k++)
+        s.indices[k] = Object_index(obj, k);
+
+    s.dead_tris = (unsigned char *) simplify_alloc(s.n_tris, sizeof(unsigned char));
+    s.quadrics = (quadric *) simplify_alloc(s.n_vertices, sizeof(quadric));
+    s.locked = (unsigned char *) simplify_alloc(s.n_vertices, sizeof(unsigned char));
+    s.removed = (unsigned char *) simplify_alloc(s.n_vertices, sizeof(unsigned char));
+    s.versions = (unsigned int *) simplify_alloc(s.n_vertices, sizeof(unsigned int));
+    s.marks = (unsigned int *) simplify_alloc(s.n_vertices, sizeof(unsigned int));
+    s.heads = (unsigned int *) simplify_alloc(s.n_vertices, sizeof(unsigned int));
+    s.tails = (unsigned int *) simplify_alloc(s.n_vertices, sizeof(unsigned int));
+    s.node_tri = (unsigned int *) simplify_alloc((size_t) 3 * s.n_tris, sizeof(unsigned int));
+    s.node_next = (unsigned int *) simplify_alloc((size_t) 3 * s.n_tris, sizeof(unsigned int));
+    memset(s.heads, 0xff, (size_t) s.n_vertices * sizeof(unsigned int));
+
+    //plane of each triangle added to the quadrics of its vertices, degenerate triangles die now
+    unsigned int alive = 0;
+    for (unsigned int t = 0; t < s.n_tris; t++)
+    {
+        const unsigned int * tri = s.indices + 3 * t;
+        double n[3];
+        triangle_normal(s.positions + 3 * (size_t) tri[0], s.positions + 3 * (size_t) tri[1], s.positions + 3 * (size_t) tri[2], n);
+        double length = sqrt(n[0] * n[0] + n[1] * n[1] + n[2] * n[2]);
+        if (length == 0.0 || tri[0] == tri[1] || tri[1] == tri[2] || tri[0] == tri[2])
+        {
+            s.dead_tris[t] = 1;
+            continue;
+        }
+        alive++;
+
+        n[0] /= length;
+        n[1] /= length;
+        n[2] /= length;
+        const float * p = s.positions + 3 * (size_t) tri[0];
+        double d = -(n[0] * p[0] + n[1] * p[1] + n[2] * p[2]);
+
+        for (unsigned int c = 0; c < 3; c++)
+        {
+            unsigned int v = tri[c];
+            quadric_plane(&s.quadrics[v], n[0], n[1], n[2], d);
+
+            unsigned int node = 3 * t + c;
+            s.node_tri[node] = t;
+            s.node_next[node] = SIMPLIFY_NONE;
+            if (s.heads[v] == SIMPLIFY_NONE)
+                s.heads[v] = node;
+            else
+                s.node_next[s.tails[v]] = node;
+            s.tails[v] = node;
+        }
+    }
+
+    simplifier_lock(&s);
+
+    for (unsigned int t = 0; t < s.n_tris; t++)
+        if (!s.dead_tris[t])
+            for (unsigned int c = 0; c < 3; c++)
+                simplifier_push(&s, s.indices[3 * t + c], s.indices[3 * t + (c + 1) % 3]);
+
+    unsigned int target = (unsigned int) (target_ratio * alive);
+    double max_cost = (double) max_error * max_error;
+
+    while (alive > target && s.heap.count > 0)
+    {
+        collapse c = heap_pop(&s.heap);
+        if (c.cost > max_cost)
+            break;
+        if (s.removed[c.from] || s.removed[c.to] || c.version_from != s.versions[c.from] || c.version_to != s.versions[c.to])
+            continue;
+        if (!simplifier_valid(&s, c.from, c.to))
+            continue;
+
+        alive -= simplifier_collapse(&s, c.from, c.to);
+    }
+
+    //the vertices still used, in their original order
+    unsigned int * remap = s.versions;
+    memset(remap, 0xff, (size_t) s.n_vertices * sizeof(unsigned int));
+    for (unsigned int t = 0; t < s.n_tris; t++)
+        if (!s.dead_tris[t])
+            for (unsigned int c = 0; c < 3; c++)
+                remap[s.indices[3 * t + c]] = 0;
+
+    unsigned int n_points = 0;
+    for (unsigned int v = 0; v < s.n_vertices; v++)
+        if (remap[v] == 0)
+            remap[v] = n_points++;
+
+    unsigned char * layout = (unsigned char *) Arena_alloc(Arena_current(), obj->n_attributes, sizeof(unsigned char));
+    memcpy(layout, obj->layout, obj->n_attributes);
+    Object * lod = Object_init(n_points, obj->n_attributes, layout, alive);
+
+    if (obj->types)
+    {
+        lod->types = (unsigned char *) Arena_alloc(lod->arena, obj->n_attributes, sizeof(unsigned char));
+        memcpy(lod->types, obj->types, obj->n_attributes);
+    }
+    lod->compact = obj->compact;
+    lod->material = obj->material;
+    memcpy(lod->dequantization, obj->dequantization, sizeof(lod->dequantization));
+    lod->bounds = obj->bounds;      //the vertices kept do not move
+
+    for (unsigned int v = 0; v < s.n_vertices; v++)
+        if (remap[v] != SIMPLIFY_NONE)
+            memcpy(lod->vertexBuffer + (size_t) remap[v] * size, obj->vertexBuffer + (size_t) v * size, size * sizeof(float));
+
+    unsigned int k = 0;
+    for (unsigned int t = 0; t < s.n_tris; t++)
+        if (!s.dead_tris[t])
+            for (unsigned int c = 0; c < 3; c++)
+                lod->indexBuffer[k++] = remap[s.indices[3 * t + c]];
+
+    free(s.positions);
+    free(s.indices);
+    free(s.dead_tris);
+    free(s.quadrics);
+    free(s.locked);
+    free(s.removed);
+    free(s.versions);
+    free(s.marks);
+    free(s.heads);
+    free(s.tails);
+    free(s.node_tri);
+    free(s.node_next);
+    free(s.heap.data);
+
+    return lod;
+}
+
+unsigned int Object_lodChain(Object * obj, unsigned int n_levels, float target_ratio, float max_error, Object ** lods)
+{
+    if (n_levels == 0)
+        return 0;
+
+    lods[0] = obj;
+    unsigned int n = 1;
+    while (n < n_levels)
+    {
+        Object * lod = Object_simplify(lods[n - 1], target_ratio, max_error);
+
+        //less than 5% removed : the error allowed is reached
+        if (lod->n_faces == 0 || lod->n_faces > 0.95f * lods[n - 1]->n_faces)
+        {
+            Object_free(lod);
+            break;
+        }
+
+        lods[n++] = lod;
+        max_error *= 2.0f;
+    }
+
+    return n;
+}
+
+typedef struct weld_args
+{
+    const Object * obj;
+    unsigned int size;                  //words per vertex
+    float epsilon;
+    unsigned int attribute_mask;
+    float inv_cell;
+    int * cells;                        //cell of each vertex, 3 coordinates
+    unsigned int bucket_mask;           //buckets - 1, a power of two
+    unsigned int * bucket_starts;       //vertices of the bucket b are bucket_vertices[bucket_starts[b], bucket_starts[b + 1][
+    unsigned int * bucket_vertices;
+    unsigned int * remap;               //smallest vertex matching each vertex
+} weld_args;
+
+static unsigned int weld_hash(int x, int y, int z)
+{
+    return ((unsigned int) x * 73856093u) ^ ((unsigned int) y * 19349663u) ^ ((unsigned int) z * 83492791u);
+}
+
+static void thread_fn_weldCells(unsigned int begin, unsigned int end, void * args)
+{
+    weld_args * a = (weld_args *) args;
+
+    for (unsigned int v = begin; v < end; v++)
+    {
+        const float * p = a->obj->vertexBuffer + (size_t) v * a->size;
+        for (unsigned char k = 0; k < 3; k++)
+        {
+            float c = floorf(p[k] * a->inv_cell);
+            c = (c < -1073741824.0f) ? -1073741824.0f : ((c > 1073741824.0f) ? 1073741824.0f : c);
+            a->cells[3 * v + k] = (int) c;
+        }
+    }
+}
+
+// positions closer than epsilon, and the attributes of the mask closer than epsilon on every component (identical when quantized)
+static bool weld_match(const weld_args * a, unsigned int u, unsigned int v)
+{
+    const Object * obj = a->obj;
+    const float * pu = obj->vertexBuffer + (size_t) u * a->size;
+    const float * pv = obj->vertexBuffer + (size_t) v * a->size;
+
+    float dx = pu[0] - pv[0];
+    float dy = pu[1] - pv[1];
+    float dz = pu[2] - pv[2];
+    if (dx * dx + dy * dy + dz * dz > a->epsilon * a->epsilon)
+        return false;
+
+    unsigned int offset = Object_attributeSize(obj, 0);
+    for (unsigned char i = 1; i < obj->n_attributes; i++)
+    {
+        unsigned int words = Object_attributeSize(obj, i);
+        if (i < 32 && (a->attribute_mask >> i) & 1u)
+        {
+            if (obj->types && obj->types[i] != ATTRIBUTE_FLOAT)
+            {
+                if (memcmp(pu + offset, pv + offset, words * sizeof(float)) != 0)
+                    return false;
+            }
+            else
+                for (unsigned int k = 0; k < words; k++)
+                    if (fabsf(pu[offset + k] - pv[offset + k]) > a->epsilon)
+                        return false;
+        }
+        offset += words;
+    }
+
+    return true;
+}
+
+// first vertex before v matching it in the 27 cells around its own (only among the kept ones if kept_only), v if none
+static unsigned int weld_find(const weld_args * a, unsigned int v, bool kept_only)
+{
+    const int * cell = a->cells + 3 * (size_t) v;
+    unsigned int best = v;
+
+    for (int dz = -1; dz <= 1; dz++)
+        for (int dy = -1; dy <= 1; dy++)
+            for (int dx = -1; dx <= 1; dx++)
+            {
+                int x = cell[0] + dx, y = cell[1] + dy, z = cell[2] + dz;
+                unsigned int nb = weld_hash(x, y, z) & a->bucket_mask;
+
+                for (unsigned int l = a->bucket_starts[nb]; l < a->bucket_starts[nb + 1]; l++)
+                {
+                    unsigned int u = a->bucket_vertices[l];
+                    const int * c = a->cells + 3 * (size_t) u;
+                    if (u < best && c[0] == x && c[1] == y && c[2] == z && (!kept_only || a->remap[u] == u) && weld_match(a, u, v))
+                        best = u;
+                }
+            }
+
+    return best;
+}
+
+static void thread_fn_weld(unsigned int begin, unsigned int end, void * args)
+{
+    weld_args * a = (weld_args *) args;
+
+    for (unsigned int b = begin; b < end; b++)
+        for (unsigned int k = a->bucket_starts[b]; k < a->bucket_starts[b + 1]; k++)
+        {
+            unsigned int v = a->bucket_vertices[k];
+            a->remap[v] = weld_find(a, v, false);
+        }
+}
+
+unsigned int Object_weld(Object * obj, float epsilon, unsigned int attribute_mask)
+{
+    if (obj->types && obj->types[0] != ATTRIBUTE_FLOAT) {
+        fprintf(stderr, "Error: Cannot weld an object with quantized positions.\n");
+        exit(EXIT_FAILURE);
+    }
+    if (epsilon < 0.0f) {
+        fprintf(stderr, "Error: Invalid welding distance %f.\n", epsilon);
+        exit(EXIT_FAILURE);
+    }
+    if (obj->n_points < 2)
+        return 0;
+
+    unsigned int n = obj->n_points;
+    unsigned int n_buckets = 1;
+    while (n_buckets < n)
+        n_buckets <<= 1;
+
+    weld_args args;
+    args.obj = obj;
+    args.size = Object_vertexSize(obj);
+    args.epsilon = epsilon;
+    args.attribute_mask = attribute_mask;
+    args.inv_cell = (epsilon > 0.0f) ? 1.0f / epsilon : 1.0f;     //cells of epsilon : the vertices to merge are in neighbor cells
+    args.bucket_mask = n_buckets - 1;
+    args.cells = (int *) malloc((size_t) 3 * n * sizeof(int));
+    args.bucket_starts = (unsigned int *) calloc((size_t) n_buckets + 1, sizeof(unsigned int));
+    args.bucket_vertices = (unsigned int *) malloc((size_t) n * sizeof(unsigned int));
+    args.remap = (unsigned int *) malloc((size_t) n * sizeof(unsigned int));
+    if (!args.cells || !args.bucket_starts || !args.bucket_vertices || !args.remap) {
+        fprintf(stderr, "Error: Memory allocation failed for welding.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    ThreadPool_parallelFor(0, n, 16384, thread_fn_weldCells, (void *) &args);
+
+    //vertices sorted by bucket (counting sort)
+    for (unsigned int v = 0; v < n; v++)
+    {
+        const int * c = args.cells + 3 * (size_t) v;
+        args.bucket_starts[(weld_hash(c[0], c[1], c[2]) & args.bucket_mask) + 1]++;
+    }
+    for (unsigned int b = 0; b < n_buckets; b++)
+        args.bucket_starts[b + 1] += args.bucket_starts[b];
+    for (unsigned int v = 0; v < n; v++)
+    {
+        const int * c = args.cells + 3 * (size_t) v;
+        unsigned int b = weld_hash(c[0], c[1], c[2]) & args.bucket_mask;
+        args.bucket_vertices[args.bucket_starts[b]++] = v;
+    }
+    for (unsigned int b = n_buckets; b > 0; b--)
+        args.bucket_starts[b] = args.bucket_starts[b - 1];
+    args.bucket_starts[0] = 0;
+
+    ThreadPool_parallelFor(0, n_buckets, 1024, thread_fn_weld, (void *) &args);
+
+    //a vertex goes to a kept vertex : when its first match was merged itself (vertices closer than epsilon
+    //in a row), the kept ones are searched again, so no vertex moves farther than epsilon
+    for (unsigned int v = 0; v < n; v++)
+        if (args.remap[args.remap[v]] != args.remap[v])
+            args.remap[v] = weld_find(&args, v, true);
+
+    unsigned int * ids = (unsigned int *) malloc((size_t) n * sizeof(unsigned int));
+    if (!ids) {
+        fprintf(stderr, "Error: Memory allocation failed for welding.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int kept = 0;
+    for (unsigned int v = 0; v < n; v++)
+        ids[v] = (args.remap[v] == v) ? kept++ : ids[args.remap[v]];
+
+    free(args.cells);
+    free(args.bucket_starts);
+    free(args.bucket_vertices);
+
+    if (kept == n)
+    {
+        free(ids);
+        free(args.remap);
+        return 0;
+    }
+
+    object_own(obj);
+
+    float * vertices = (float *) Arena_alloc(obj->arena, (size_t) kept * args.size, sizeof(float));
+    for (unsigned int v = 0; v < n; v++)
+        if (args.remap[v] == v)
+            memcpy(vertices + (size_t) ids[v] * args.size, obj->vertexBuffer + (size_t) v * args.size, args.size * sizeof(float));
+
+    //the object gets its own indices, triangles collapsed by the merge are dropped
+    unsigned int * indices = (unsigned int *) Arena_alloc(obj->arena, (size_t) 3 * obj->n_faces, sizeof(unsigned int));
+    unsigned int n_faces = 0;
+    for (unsigned int t = 0; t < obj->n_faces; t++)
+    {
+        unsigned int a = ids[Object_index(obj, 3 * t)];
+        unsigned int b = ids[Object_index(obj, 3 * t + 1)];
+        unsigned int c = ids[Object_index(obj, 3 * t + 2)];
+        if (a == b || b == c || c == a)
+            continue;
+
+        indices[3 * n_faces] = a;
+        indices[3 * n_faces + 1] = b;
+        indices[3 * n_faces + 2] = c;
+        n_faces++;
+    }
+
+    Arena_release(obj->arena, obj->vertexBuffer);
+    Arena_release(obj->arena, obj->indexBuffer);
+    obj->vertexBuffer = vertices;
+    obj->indexBuffer = indices;
+    obj->grid = NULL;
+    obj->n_points = kept;
+    obj->n_faces = n_faces;
+
+    free(ids);
+    free(args.remap);
+
+    return n - kept;
+}
+
+#define OBJECT_FILE_MAGIC 0x4853454du      //"MESH"
+#define OBJECT_FILE_VERSION 2u
+#define OBJECT_FILE_ALIGN 64
+
+#define OBJECT_ENCODING_RAW 0       //mapped as they are
+#define OBJECT_ENCODING_CODEC 1     //MeshCodec streams, decoded at load
+
+/**
+ * header of a mesh file, the offsets are from the start of the file and multiples of OBJECT_FILE_ALIGN :
+ * layout[n_attributes] then types[n_attributes] (all ATTRIBUTE_FLOAT when the object has none),
+ * vertices (n_points * vertex_size bytes), indices (3 * n_faces unsigned int), or their encoded streams
+ */
+typedef struct object_file_header
+{
+    unsigned int magic;
+    unsigned int version;
+    unsigned long long hash;
+    unsigned int n_points;
+    unsigned int n_faces;
+    unsigned int vertex_size;       //bytes
+    unsigned char n_attributes;
+    unsigned char compact;
+    unsigned char has_types;
+    unsigned char encoding;         //OBJECT_ENCODING_*
+    Material material;
+    float dequantization[4];
+    float bounds[6];                //min and max of the positions
+    unsigned long long layout_offset;
+    unsigned long long vertex_offset;
+    unsigned long long vertex_bytes;
+    unsigned long long index_offset;
+    unsigned long long index_bytes;
+    unsigned long long file_size;
+} object_file_header;
+
+typedef struct object_mapping
+{
+    void * base;
+    size_t size;
+#ifdef _WIN32
+    HANDLE file;
+    HANDLE map;
+#endif
+} object_mapping;
+
+unsigned long long Object_hash(const void * data, size_t size, unsigned long long seed)
+{
+    const unsigned char * bytes = (const unsigned char *) data;
+    unsigned long long h = seed ? seed : 14695981039346656037ULL;
+
+    for (size_t i = 0; i < size; i++)
+    {
+        h ^= bytes[i];
+        h *= 1099511628211ULL;
+    }
+
+    return h;
+}
+
+static unsigned long long file_align(unsigned long long offset)
+{
+    return (offset + OBJECT_FILE_ALIGN - 1) / OBJECT_FILE_ALIGN * OBJECT_FILE_ALIGN;
+}
+
+// zeros from the offset from to the offset to, to align the next section of the file
+static bool write_padding(FILE * file, unsigned long long from, unsigned long long to)
+{
+    static const unsigned char zeros[OBJECT_FILE_ALIGN] = { 0 };
+    return to == from || fwrite(zeros, 1, (size_t) (to - from), file) == to - from;
+}
+
+static bool object_write(const Object * obj, const char * filepath, unsigned long long hash, unsigned char encoding)
+{
+    object_file_header header;
+    memset(&header, 0, sizeof(object_file_header));
+    header.magic = OBJECT_FILE_MAGIC;
+    header.version = OBJECT_FILE_VERSION;
+    header.hash = hash;
+    header.n_points = obj->n_points;
+    header.n_faces = obj->n_faces;
+    header.vertex_size = Object_vertexSize(obj) * sizeof(float);
+    header.n_attributes = obj->n_attributes;
+    header.compact = obj->compact;
+    header.has_types = obj->types != NULL;
+    header.encoding = encoding;
+    header.material = obj->material;
+    memcpy(header.dequantization, obj->dequantization, sizeof(header.dequantization));
+    object_bounds(obj, header.bounds);
+
+    //shared grid indices are written as the 32 bits indices of the object
+    unsigned int n_indices = 3 * obj->n_faces;
+    unsigned int * indices = (unsigned int *) malloc((size_t) n_indices * sizeof(unsigned int) + sizeof(unsigned int));
+    if (!indices) {
+        fprintf(stderr, "Error: Memory allocation failed for mesh file.\n");
+        exit(EXIT_FAILURE);
+    }
+    for (unsigned int k = 0; k < n_indices; k++)
+        indices[k] = Object_index(obj, k);
+
+    const void * vertex_data = obj->vertexBuffer;
+    const void * index_data = indices;
+    unsigned char * vertex_stream = NULL;
+    unsigned char * index_stream = NULL;
+    header.vertex_bytes = (unsigned long long) obj->n_points * header.vertex_size;
+    header.index_bytes = (unsigned long long) n_indices * sizeof(unsigned int);
+
+    if (encoding == OBJECT_ENCODING_CODEC)
+    {
+        size_t vertex_bound = MeshCodec_encodeVertexBound(obj->n_points, header.vertex_size);
+        size_t index_bound = MeshCodec_encodeIndexBound(n_indices);
+        vertex_stream = (unsigned char *) malloc(vertex_bound);
+        index_stream = (unsigned char *) malloc(index_bound);
+        if (!vertex_stream || !index_stream) {
+            fprintf(stderr, "Error: Memory allocation failed for mesh file.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        header.vertex_bytes = MeshCodec_encodeVertices(vertex_stream, vertex_bound, obj->vertexBuffer, obj->n_points, header.vertex_size);
+        header.index_bytes = MeshCodec_encodeIndices(index_stream, index_bound, indices, n_indices);
+        vertex_data = vertex_stream;
+        index_data = index_stream;
+    }
+
+    header.layout_offset = file_align(sizeof(object_file_header));
+    header.vertex_offset = file_align(header.layout_offset + 2ULL * obj->n_attributes);
+    header.index_offset = file_align(header.vertex_offset + header.vertex_bytes);
+    header.file_size = header.index_offset + header.index_bytes;
+
+    unsigned char types[256];
+    memset(types, ATTRIBUTE_FLOAT, sizeof(types));
+    if (obj->types)
+        memcpy(types, obj->types, obj->n_attributes);
+
+    FILE * file = fopen(filepath, "wb");
+    bool ok = file != NULL;
+
+    ok = ok && fwrite(&header, sizeof(object_file_header), 1, file) == 1
+     && write_padding(file, sizeof(object_file_header), header.layout_offset)
+     && fwrite(obj->layout, 1, obj->n_attributes, file) == obj->n_attributes
+     && fwrite(types, 1, obj->n_attributes, file) == obj->n_attributes
+     && write_padding(file, header.layout_offset + 2ULL * obj->n_attributes, header.vertex_offset)
+     && (header.vertex_bytes == 0 || fwrite(vertex_data, 1, (size_t) header.vertex_bytes, file) == header.vertex_bytes)
+     && write_padding(file, header.vertex_offset + header.vertex_bytes, header.index_offset)
+     && (header.index_bytes == 0 || fwrite(index_data, 1, (size_t) header.index_bytes, file) == header.index_bytes);
+
+    if (file)
+    {
+        ok = (fclose(file) == 0) && ok;
+        if (!ok)
+            remove(filepath);
+    }
+
+    free(indices);
+    free(vertex_stream);
+    free(index_stream);
+    return ok;
+}
+
+bool Object_save(const Object * obj, const char * filepath, unsigned long long hash)
+{
+    return object_write(obj, filepath, hash, OBJECT_ENCODING_RAW);
+}
+
+bool Object_saveEncoded(const Object * obj, const char * filepath, unsigned long long hash)
+{
+    return object_write(obj, filepath, hash, OBJECT_ENCODING_CODEC);
+}
+
+static void object_unmap(void * mapping)
+{
+    object_mapping * m = (object_mapping *) mapping;
+#ifdef _WIN32
+    UnmapViewOfFile(m->base);
+    CloseHandle(m->map);
+    CloseHandle(m->file);
+#else
+    munmap(m->base, m->size);
+#endif
+    free(m);
+}
+
+static object_mapping * object_map(const char * filepath)
+{
+    object_mapping * m = (object_mapping *) calloc(1, sizeof(object_mapping));
+    if (!m) {
+        fprintf(stderr, "Error: Memory allocation failed for file mapping.\n");
+        exit(EXIT_FAILURE);
+    }
+
+#ifdef _WIN32
+    m->file = CreateFileA(filepath, GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    LARGE_INTEGER size;
+    if (m->file == INVALID_HANDLE_VALUE || !GetFileSizeEx(m->file, &size) || size.QuadPart < (LONGLONG) sizeof(object_file_header))
+    {
+        if (m->file != INVALID_HANDLE_VALUE)
+            CloseHandle(m->file);
+        free(m);
+        return NULL;
+    }
+    m->size = (size_t) size.QuadPart;
+
+    //pages copied on write : the object can be modified like any other
+    m->map = CreateFileMappingA(m->file, NULL, PAGE_WRITECOPY, 0, 0, NULL);
+    m->base = m->map ? MapViewOfFile(m->map, FILE_MAP_COPY, 0, 0, 0) : NULL;
+    if (!m->base)
+    {
+        if (m->map)
+            CloseHandle(m->map);
+        CloseHandle(m->file);
+        free(m);
+        return NULL;
+    }
+#else
+    int fd = open(filepath, O_RDONLY);
+    struct stat st;
+    if (fd < 0 || fstat(fd, &st) != 0 || st.st_size < (off_t) sizeof(object_file_header))
+    {
+        if (fd >= 0)
+            close(fd);
+        free(m);
+        return NULL;
+    }
+    m->size = (size_t) st.st_size;
+
+    //pages copied on write : the object can be modified like any other
+    m->base = mmap(NULL, m->size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (m->base == MAP_FAILED)
+    {
+        free(m);
+        return NULL;
+    }
+#endif
+
+    return m;
+}
+
+// one linear pass over the indices, on the mapping for raw files
+static bool indices_in_range(const Object * obj)
+{
+    unsigned int n_points = obj->n_points;
+    unsigned int out = 0;
+    for (size_t k = 0; k < 3 * (size_t) obj->n_faces; k++)
+        out |= (obj->indexBuffer[k] >= n_points);
+    return out == 0;
+}
+
+Object * Object_load(const char * filepath, unsigned long long hash)
+{
+    object_mapping * m = object_map(filepath);
+    if (!m)
+        return NULL;
+
+    unsigned char * base = (unsigned char *) m->base;
+    const object_file_header * header = (const object_file_header *) base;
+
+    bool raw = header->encoding == OBJECT_ENCODING_RAW;
+    bool valid = header->magic == OBJECT_FILE_MAGIC && header->version == OBJECT_FILE_VERSION && header->hash == hash
+     && header->file_size == m->size && header->encoding <= OBJECT_ENCODING_CODEC
+     && header->layout_offset % OBJECT_FILE_ALIGN == 0 && header->vertex_offset % OBJECT_FILE_ALIGN == 0 && header->index_offset % OBJECT_FILE_ALIGN == 0
+     && header->layout_offset + 2ULL * header->n_attributes <= header->vertex_offset
+     && header->vertex_offset + header->vertex_bytes <= header->index_offset
+     && header->index_offset + header->index_bytes <= m->size
+     && (!raw || (header->vertex_bytes == (unsigned long long) header->n_points * header->vertex_size
+      && header->index_bytes == 3ULL * header->n_faces * sizeof(unsigned int)));
+
+    if (!valid)
+    {
+        object_unmap(m);
+        return NULL;
+    }
+
+    Object * obj = (Object *) calloc(1, sizeof(Object));
+    if (!obj) {
+        fprintf(stderr, "Error: Memory allocation failed for object.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    obj->n_points = header->n_points;
+    obj->n_faces = header->n_faces;
+    obj->n_attributes = header->n_attributes;
+    obj->layout = base + header->layout_offset;
+    obj->types = header->has_types ? base + header->layout_offset + header->n_attributes : NULL;
+    obj->vertexBuffer = (float *) (base + header->vertex_offset);
+    obj->indexBuffer = (unsigned int *) (base + header->index_offset);
+    obj->compact = header->compact;
+    obj->material = header->material;
+    memcpy(obj->dequantization, header->dequantization, sizeof(obj->dequantization));
+    Object_setBounds(obj, header->bounds, header->bounds + 3, 0.0f);
+    obj->mapping = m;
+
+    //the sizes of the layout must be those of the blobs
+    for (unsigned char i = 0; valid && i < obj->n_attributes; i++)
+        valid = (!obj->types || obj->types[i] <= ATTRIBUTE_UNORM8);
+    if (!valid || Object_vertexSize(obj) * sizeof(float) != header->vertex_size)
+    {
+        Object_free(obj);
+        return NULL;
+    }
+
+    //a damaged file with a matching header must not reach glDrawElements with indices out of the vertices
+    if (raw)
+    {
+        if (indices_in_range(obj))
+            return obj;
+        Object_free(obj);
+        return NULL;
+    }
+
+    //encoded streams : the object gets its own buffers and the file is released
+    Object * decoded = obj;
+    const unsigned char * vertex_stream = (const unsigned char *) obj->vertexBuffer;
+    const unsigned char * index_stream = (const unsigned char *) obj->indexBuffer;
+    obj->layout = (unsigned char *) own_copy(obj->layout, obj->n_attributes);
+    if (obj->types)
+        obj->types = (unsigned char *) own_copy(obj->types, obj->n_attributes);
+    obj->vertexBuffer = (float *) malloc((size_t) obj->n_points * header->vertex_size + sizeof(float));
+    obj->indexBuffer = (unsigned int *) malloc((size_t) 3 * obj->n_faces * sizeof(unsigned int) + sizeof(unsigned int));
+    if (!obj->vertexBuffer || !obj->indexBuffer) {
+        fprintf(stderr, "Error: Memory allocation failed for mesh decoding.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (!MeshCodec_decodeVertices(obj->vertexBuffer, obj->n_points, header->vertex_size, vertex_stream, (size_t) header->vertex_bytes)
+     || !MeshCodec_decodeIndices(obj->indexBuffer, 3 * obj->n_faces, index_stream, (size_t) header->index_bytes))
+        decoded = NULL;
+
+    if (decoded && !indices_in_range(obj))
+        decoded = NULL;
+
+    object_unmap(m);
+    obj->mapping = NULL;
+    if (!decoded)
+        Object_free(obj);
+
+    return decoded;
+}
+
+void Object_free(Object * obj)
+{
+    if (!obj)
+        return;
+
+    //a loaded object comes from the heap, its buffers from the file
+    if (obj->mapping)
+    {
+        object_unmap(obj->mapping);
+        free(obj);
+        return;
+    }
+
+    Arena_release(obj->arena, obj->vertexBuffer);
+    Arena_release(obj->arena, obj->indexBuffer);
+    Arena_release(obj->arena, obj->layout);
+    Arena_release(obj->arena, obj->types);
+    Arena_release(obj->arena, obj);
 }
\ No newline at end of file
@@ -1,36 +1,322 @@
-/**
- * @file Object.h
- * @brief Header for struct Object
- * @author Antony Madaleno
- * @version 1.0
- * @date 21-09-2023
- *
- * Header pour les struct Object
- *
- */
-
-#pragma once
-
-/**
- * @struct Object
- */
-typedef struct Object
-{
-    unsigned int n_points;
-    unsigned char n_attributes;
-    unsigned char * layout;
-    unsigned int n_faces;
-    float * vertexBuffer;
-    unsigned int * indexBuffer;
-} Object;
-
-/**
- * @brief initialize my object structure and allocate the memory
- * 
- * @param n_point 
- * @param n_faces
- * @param n_attributes 
- * @param a_layout
- * @return Object* 
- */
-Object * Object_init(const unsigned int n_points, const unsigned char n_attributes, unsigned char * layout, const unsigned int n_faces);
\ No newline at end of file
+/**
+ * @file Object.h
+ * @brief Header for struct Object
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 21-09-2023
+ *
+ * Header pour les struct Object
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+
+#include "Arena.h"
+
+/**
+ * @brief topology of a grid of rows x cols vertices (vertex (i, j) is at i * cols + j), flags can be combined
+ */
+#define GRID_OPEN 0
+#define GRID_WRAP_ROWS 1    //the last row is linked to the first one
+#define GRID_WRAP_COLS 2    //the last column is linked to the first one
+#define GRID_POLES 4        //vertex 0 and the last vertex are poles linked to the first and last rows, the grid starts at 1 and its columns wrap
+
+/**
+ * @brief floats per vertex : position, normal, color, specular, shininess and reflection,
+ * or only position and normal for a compact object
+ */
+#define VERTEX_SIZE 14
+#define VERTEX_COMPACT_SIZE 6
+
+/**
+ * @brief storage of an attribute, every type fills whole 4 bytes words so vertexBuffer stays a float array
+ */
+#define ATTRIBUTE_FLOAT 0       //layout[i] floats
+#define ATTRIBUTE_SNORM16 1     //layout[i] signed 16 bits normalized to [-1, 1], padded to 4 bytes
+#define ATTRIBUTE_OCT16 2       //unit vector folded on an octahedron, 2 signed 16 bits normalized
+#define ATTRIBUTE_UNORM8 3      //layout[i] (at most 4) unsigned 8 bits normalized to [0, 1]
+
+/**
+ * @struct Material
+ * @brief attributes 2 to 5 of the vertices, given once for the whole draw of a compact object
+ */
+typedef struct Material
+{
+    float color[3];
+    float specular[3];
+    float shininess;
+    float reflection;
+} Material;
+
+/**
+ * @struct Bounds
+ * @brief box and sphere holding the positions of an object, in the space of its vertices
+ */
+typedef struct Bounds
+{
+    float min[3];
+    float max[3];
+    float center[3];
+    float radius;               //INFINITY while the bounds are unknown, the object is then never culled
+} Bounds;
+
+/**
+ * @struct GridIndices
+ * @brief immutable triangles of a grid shared by every object with the same topology
+ * (also used for other shared topologies, rows, cols and wrap are then 0)
+ */
+typedef struct GridIndices
+{
+    unsigned int rows, cols;
+    unsigned char wrap;
+    unsigned char index_size;   //2 or 4 bytes
+    unsigned int count;         //number of indices
+    const void * data;          //unsigned short or unsigned int indices
+    unsigned int EBO;           //GPU copy uploaded by the first buffer using it, 0 until then
+} GridIndices;
+
+/**
+ * @struct Object
+ */
+typedef struct Object
+{
+    unsigned int n_points;
+    unsigned char n_attributes;
+    unsigned char * layout;
+    unsigned int n_faces;
+    float * vertexBuffer;
+    unsigned int * indexBuffer;     //indices owned by the object, NULL when they come from the grid cache
+    GridIndices * grid;             //shared indices used instead of indexBuffer
+    unsigned char compact;          //vertices hold only position and normal, the rest is material
+    Material material;
+    unsigned char * types;          //ATTRIBUTE_* of each attribute, NULL when they are all floats
+    float dequantization[4];        //center and scale of the positions of a quantized object
+    void * mapping;                 //file holding the buffers of an object from Object_load, NULL otherwise
+    Arena * arena;                  //arena of the object and its buffers (see Arena_begin), NULL for the heap
+    Bounds bounds;                  //set by the generators, see Object_computeBounds
+} Object;
+
+/**
+ * @brief initialize my object structure and allocate the memory, from the arena of the current scope if any
+ * 
+ * @param n_point 
+ * @param n_faces
+ * @param n_attributes 
+ * @param a_layout
+ * @return Object* 
+ */
+Object * Object_init(const unsigned int n_points, const unsigned char n_attributes, unsigned char * layout, const unsigned int n_faces);
+
+/**
+ * @brief initialize an object whose triangles are shared grid indices, only the vertices are allocated
+ * 
+ * @param n_points 
+ * @param n_attributes 
+ * @param layout 
+ * @param grid see Object_gridIndices
+ * @return Object* 
+ */
+Object * Object_initGrid(const unsigned int n_points, const unsigned char n_attributes, unsigned char * layout, GridIndices * grid);
+
+/**
+ * @brief free an object, its buffers and its layout, whether it comes from Object_init, Object_load or an arena
+ * (nothing is done for an arena object, its memory goes with Arena_reset or Arena_free)
+ * 
+ * @param obj the layout given to Object_init must come from Arena_alloc(Arena_current(), ...) or calloc
+ */
+void Object_free(Object * obj);
+
+/**
+ * @brief bounds of the positions of the object : the box, then the sphere centered on it through the farthest vertex
+ * (call it again once the positions have been modified by hand)
+ * 
+ * @param obj 
+ */
+void Object_computeBounds(Object * obj);
+
+/**
+ * @brief bounds known by a generator without reading the vertices back : the sphere is centered on the box
+ * 
+ * @param obj 
+ * @param min 
+ * @param max 
+ * @param radius radius of the sphere, 0 for the half diagonal of the box
+ */
+void Object_setBounds(Object * obj, const float * min, const float * max, float radius);
+
+/**
+ * @brief grow the bounds so that they hold the box of a part of the object that has just moved (local updates)
+ * the bounds never shrink : they stay conservative for culling, Object_computeBounds makes them tight again
+ * 
+ * @param obj 
+ * @param min 
+ * @param max 
+ */
+void Object_growBounds(Object * obj, const float * min, const float * max);
+
+/**
+ * @brief return the cached triangles of a grid, built on first request and never modified afterwards
+ * 
+ * @param rows 
+ * @param cols 
+ * @param wrap GRID_* flags
+ * @param index_size 2 or 4 bytes, 0 to use 16 bits indices whenever the vertex count allows it
+ * @return GridIndices* 
+ */
+GridIndices * Object_gridIndices(unsigned int rows, unsigned int cols, unsigned char wrap, unsigned char index_size);
+
+/**
+ * @brief index i of an object, whether its triangles are owned or shared
+ * 
+ * @param obj 
+ * @param i 
+ * @return unsigned int 
+ */
+unsigned int Object_index(const Object * obj, unsigned int i);
+
+/**
+ * @brief number of 4 bytes words of the attribute i of the object
+ * 
+ * @param obj 
+ * @param i 
+ * @return unsigned int 
+ */
+unsigned int Object_attributeSize(const Object * obj, unsigned char i);
+
+/**
+ * @brief number of floats (4 bytes words for a quantized object) of a vertex of the object
+ * 
+ * @param obj 
+ * @return unsigned int 
+ */
+unsigned int Object_vertexSize(const Object * obj);
+
+/**
+ * @brief move the material out of the vertices of an object with the 14 floats layout,
+ * its vertices keep only position and normal (24 bytes instead of 56)
+ * the material is read from the first vertex, every vertex must share it
+ * 
+ * @param obj 
+ * @return Object* the same object
+ */
+Object * Object_compact(Object * obj);
+
+/**
+ * @brief quantize the vertices of an object with the 14 floats or the compact layout :
+ * 16 bits positions in the bounding cube, octahedral 16 bits normals, 8 bits colors (28 bytes, 12 when compact)
+ * the shaders get the dequantization from constant attributes set by Buffer_draw,
+ * a quantized object can not be updated anymore
+ * 
+ * @param obj 
+ * @return Object* the same object
+ */
+Object * Object_quantize(Object * obj);
+
+/**
+ * @brief average cache miss ratio of the triangles of an object : vertices transformed per triangle
+ * with a post transform FIFO cache of cache_size entries (0.5 at best, 3 at worst)
+ * 
+ * @param obj 
+ * @param cache_size 
+ * @return float 
+ */
+float Object_acmr(const Object * obj, unsigned int cache_size);
+
+/**
+ * @brief reorder the triangles of an object for the post transform vertex cache (Tipsify), then
+ * renumber its vertices in order of first use so they are fetched sequentially
+ * shared indices are copied to the object first, and the vertices of curves and surfaces are no longer
+ * in grid order : do it once the object will not be updated anymore
+ * 
+ * @param obj 
+ * @param cache_size entries of the cache to optimize for (16 to 32 on current GPUs)
+ * @param overdraw 1 to also draw the clusters of triangles facing outward first, less overdraw for a few misses more
+ * @param acmr_before ACMR of the original order (can be NULL)
+ * @param acmr_after ACMR of the new order (can be NULL)
+ */
+void Object_optimizeIndices(Object * obj, unsigned int cache_size, unsigned char overdraw, float * acmr_before, float * acmr_after);
+
+/**
+ * @brief simplified copy of an object (Garland-Heckbert quadric error metrics) : its edges are collapsed
+ * by increasing error onto one of their vertices, the vertices kept have their attributes unchanged
+ * vertices on a border or sharing their position with others (seams) are locked
+ * 
+ * @param obj object with float positions (simplify it before Object_quantize)
+ * @param target_ratio part of the triangles to keep
+ * @param max_error collapses stop before moving the surface farther than this distance
+ * @return Object* new object with its own indices
+ */
+Object * Object_simplify(const Object * obj, float target_ratio, float max_error);
+
+/**
+ * @brief levels of detail of an object, each simplified from the previous one with Object_simplify,
+ * the error allowed doubles at each level and the chain stops when a level does not get simpler
+ * 
+ * @param obj level 0, not copied
+ * @param n_levels size of lods
+ * @param target_ratio part of the triangles of the previous level to keep
+ * @param max_error error allowed at level 1
+ * @param lods lods[0] is obj, then the new objects
+ * @return unsigned int number of levels written
+ */
+unsigned int Object_lodChain(Object * obj, unsigned int n_levels, float target_ratio, float max_error, Object ** lods);
+
+/**
+ * @brief merge the vertices closer than epsilon (pole vertices, seam rings, borders of stitched patches) :
+ * the vertices are hashed in cells of epsilon and each one is compared to those of the 27 cells around it,
+ * in parallel over the hash buckets, then the first vertex of each group is kept (in the same order),
+ * the indices are remapped and the triangles collapsed by the merge are dropped
+ * shared indices are copied to the object first, when vertices are merged
+ * 
+ * @param obj object with float positions (weld it before Object_quantize)
+ * @param epsilon largest distance between merged vertices, 0 for identical positions
+ * @param attribute_mask bit i set : the attribute i must also match (within epsilon on each component)
+ * to merge, e.g. 1 << 1 keeps the normals of hard edges apart, 0 merges on the position only
+ * @return unsigned int number of vertices removed
+ */
+unsigned int Object_weld(Object * obj, float epsilon, unsigned int attribute_mask);
+
+/**
+ * @brief write an object to a mesh file that Object_load maps back without parsing :
+ * header (version, parameter hash, counts, material, bounding box), layout and types, then the vertices
+ * and the 32 bits indices aligned on 64 bytes, in the byte order of the machine
+ * 
+ * @param obj 
+ * @param filepath 
+ * @param hash parameters the object was generated from, checked by Object_load
+ * @return true if the file was written
+ */
+bool Object_save(const Object * obj, const char * filepath, unsigned long long hash);
+
+/**
+ * @brief write an object to a mesh file with its vertices and indices compressed (see MeshCodec),
+ * Object_load decodes it into buffers of its own instead of mapping them
+ * 
+ * @param obj quantize it first (Object_quantize) for the best ratio, the codec itself loses nothing
+ * @param filepath 
+ * @param hash 
+ * @return true if the file was written
+ */
+bool Object_saveEncoded(const Object * obj, const char * filepath, unsigned long long hash);
+
+/**
+ * @brief map a mesh file written by Object_save, the buffers of the object are the pages of the file
+ * (copied on write) and go straight to glBufferData, a file from Object_saveEncoded is decoded instead
+ * 
+ * @param filepath 
+ * @param hash expected parameter hash
+ * @return Object* NULL if the file is missing, of another version or hash, or invalid (indices out of the vertices included), free it with Object_free
+ */
+Object * Object_load(const char * filepath, unsigned long long hash);
+
+/**
+ * @brief FNV-1a hash of generator parameters, chain calls through seed (0 to start)
+ * 
+ * @param data 
+ * @param size 
+ * @param seed 
+ * @return unsigned long long 
+ */
+unsigned long long Object_hash(const void * data, size_t size, unsigned long long seed);
\ No newline at end of file
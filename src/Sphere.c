@@ -1,210 +1,429 @@
-#include "Sphere.h"
-#include "pthread.h"
-#include <stdio.h>
-#include <math.h>
-
-#ifndef M_PI
-#define M_PI 3.1415926535897932384626433832795
-#endif
-
-Sphere * Sphere_init(float rx, float ry, float rz)
-{
-    Sphere * s = (Sphere *) calloc(1, sizeof(Sphere) );
-    s->rx = rx;
-    s->ry = ry;
-    s->rz = rz;
-
-    return s;
-}
-
-typedef struct Thread_args
-{
-    unsigned char m;
-    unsigned char p;
-    unsigned char n;
-    Object * o;
-    Sphere * s;
-    float theta;
-    Vec3 * color;
-    Vec3 * specular;
-    float shine;
-    float refl;
-} Thread_args;
-
-void * thread_drawParallel(void * args)
-{
-    Thread_args * t_args = (Thread_args *) args;
-    unsigned char m = t_args->m;
-    unsigned char n = t_args->n;
-    unsigned char p = t_args->p;
-    Object * o = t_args->o;
-    Sphere * s = t_args->s;
-    float theta = t_args->theta;
-    Vec3 * color = t_args->color;
-    Vec3 * specular = t_args->specular;
-    float shine = t_args->shine;
-    float refl = t_args->refl;
-
-    unsigned short offset = p * m + 1;
-    unsigned int size = 14;
-
-    for (unsigned char i = 0; i < m; i++)
-    {
-        //vertex
-        float alpha = ((float) i) / ((float) m) * 2 * M_PI;
-
-        o->vertexBuffer[(offset + i) * size + 0]  = s->rx * cosf( theta ) * cosf( alpha );
-        o->vertexBuffer[(offset + i) * size + 2]  = s->rz * cosf( theta ) * sinf( alpha );
-        o->vertexBuffer[(offset + i) * size + 1]  = s->ry * sinf( theta );
-
-        o->vertexBuffer[(offset + i) * size + 3]  = o->vertexBuffer[(offset + i) * size + 0];
-        o->vertexBuffer[(offset + i) * size + 4]  = o->vertexBuffer[(offset + i) * size + 1];
-        o->vertexBuffer[(offset + i) * size + 5]  = o->vertexBuffer[(offset + i) * size + 2];
-
-        o->vertexBuffer[(offset + i) * size + 6]  = color->x;
-        o->vertexBuffer[(offset + i) * size + 7]  = color->y;
-        o->vertexBuffer[(offset + i) * size + 8]  = color->z;
-
-        o->vertexBuffer[(offset + i) * size + 9]  = specular->x;
-        o->vertexBuffer[(offset + i) * size + 10] = specular->y;
-        o->vertexBuffer[(offset + i) * size + 11] = specular->z;
-
-        o->vertexBuffer[(offset + i) * size + 12] = shine;
-        o->vertexBuffer[(offset + i) * size + 13] = refl;
-
-        //index
-        unsigned in = (i+1)% m;
-        unsigned jn = (p+1)% n;
-
-        unsigned p0 = p  * m + i  + 1;
-        unsigned p1 = p  * m + in + 1;
-        unsigned p2 = jn * m + in + 1;
-        unsigned p3 = jn * m + i  + 1;
-
-        unsigned int index = ((unsigned int) m * 3) + ((unsigned int) m * p * 6) + ((unsigned int) i * 6);
-
-        o->indexBuffer[ index + 0 ] = p0;
-        o->indexBuffer[ index + 1 ] = p3;
-        o->indexBuffer[ index + 2 ] = p2;
-
-        o->indexBuffer[ index + 3 ] = p0;
-        o->indexBuffer[ index + 4 ] = p2;
-        o->indexBuffer[ index + 5 ] = p1;
-    }
-
-    return NULL;
-}
-
-Object * Sphere_generateSurface(
-    Sphere * sphere,
-    unsigned char meridian,
-    unsigned char parallel,
-    Vec3 * color,
-    Vec3 * specular,
-    float reflection,
-    float shininess
-)
-{
-
-    //CREATE THE LAYOUT
-    unsigned char * layout = (unsigned char *) calloc(6, sizeof(unsigned char));
-    layout[0] = 3; //Vertex Position
-    layout[1] = 3; //Vertex Normal
-    layout[2] = 3; //Vertex Color
-    layout[3] = 3; //Vertex Specular
-    layout[4] = 1; //Vertex Shininess
-    layout[5] = 1; //Vertex Reflection
-
-    //CREATE THE OBJECT
-    Object * obj = Object_init( meridian * parallel + 2, 6, layout, 2 * meridian * (parallel + 1) );
-
-    //CREATE POLES
-    Vec3 * north = (Vec3 *) calloc(1, sizeof(Vec3) );     
-    Vec3_set(north, 0.0f, sphere->ry, 0.0f);
-
-    unsigned int size = 14;
-
-    obj->vertexBuffer[(obj->n_points - 1) * size - 1]  = north->x;
-    obj->vertexBuffer[(obj->n_points - 1) * size - 0]  = north->z;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 1]  = north->y;
-
-    obj->vertexBuffer[(obj->n_points - 1) * size + 2]  = north->x;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 3]  = north->z;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 4]  = north->y;
-
-    obj->vertexBuffer[(obj->n_points - 1) * size + 5]  = color->x;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 6]  = color->y;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 7]  = color->z;
-
-    obj->vertexBuffer[(obj->n_points - 1) * size + 8]  = specular->x;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 9]  = specular->y;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 10] = specular->z;
-
-    obj->vertexBuffer[(obj->n_points - 1) * size + 11] = shininess;
-    obj->vertexBuffer[(obj->n_points - 1) * size + 12] = reflection;
-
-    Vec3 * south = (Vec3 *) calloc(1, sizeof(Vec3) );
-    Vec3_set(south, 0.0, sphere->ry, 0.0);
-
-    obj->vertexBuffer[0]  = south->x;
-    obj->vertexBuffer[1]  = south->z;
-    obj->vertexBuffer[2]  = south->y;
-
-    obj->vertexBuffer[3]  = south->x;
-    obj->vertexBuffer[4]  = south->z;
-    obj->vertexBuffer[5]  = south->y;
-
-    obj->vertexBuffer[6]  = color->x;
-    obj->vertexBuffer[7]  = color->y;
-    obj->vertexBuffer[8]  = color->z;
-
-    obj->vertexBuffer[9]  = specular->x;
-    obj->vertexBuffer[10] = specular->y;
-    obj->vertexBuffer[11] = specular->z;
-
-    obj->vertexBuffer[12] = shininess;
-    obj->vertexBuffer[13] = reflection;
-
-    free(south);
-    free(north);
-
-    unsigned char i;
-    for (i = 0; i < meridian; i++)
-    {
-        obj->indexBuffer[i*3 + 0] = 0;
-        obj->indexBuffer[i*3 + 1] = 1 + i;
-        obj->indexBuffer[i*3 + 2] = 1 + (i+1) % meridian;
-
-        obj->indexBuffer[obj->n_faces * 3 - i*3 - 3] = obj->n_points - 1;
-        obj->indexBuffer[obj->n_faces * 3 - i*3 - 2] = obj->n_points - 2 - i;
-        obj->indexBuffer[obj->n_faces * 3 - i*3 - 1] = obj->n_points - 2 - ((i+1) % meridian);
-    }
-
-    //CREATE EACH PARALLELS
-    pthread_t * threads = (pthread_t *) calloc(parallel, sizeof(pthread_t) );
-    Thread_args * t_args = (Thread_args *) calloc(parallel, sizeof(Thread_args) );
-
-    for (i = 0; i < parallel; i++)
-    {
-        t_args[i].m = meridian;
-        t_args[i].p = i;
-        t_args[i].n = parallel;
-        t_args[i].o = obj;
-        t_args[i].s = sphere;
-        t_args[i].refl = reflection;
-        t_args[i].shine = shininess;
-        t_args[i].color = color;
-        t_args[i].specular = specular;
-        t_args[i].theta = ( (float) i ) / ( (float) parallel + 2) * M_PI - M_PI/2;
-
-        pthread_create(&threads[i], NULL, thread_drawParallel, (void *) &t_args[i]);
-    }
-
-    for (i = 0; i < parallel; i++)
-        pthread_join(threads[i], NULL);
-
-    free(threads);
-    free(t_args);
-    return obj;
-}
-
+#include "Sphere.h"
+#include "ThreadPool.h"
+#include "VertexFormat.hpp"
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#ifndef M_PI
+#define M_PI 3.1415926535897932384626433832795
+#endif
+
+Sphere * Sphere_init(float rx, float ry, float rz)
+{
+    Sphere * s = (Sphere *) calloc(1, sizeof(Sphere) );
+    s->rx = rx;
+    s->ry = ry;
+    s->rz = rz;
+
+    return s;
+}
+
+typedef struct Thread_args
+{
+    unsigned short m;
+    unsigned short n;
+    Object * o;
+    Sphere * s;
+    const float * cos_a;        //cosinus and sinus of the meridian angles, shared by every parallel
+    const float * sin_a;
+    StandardVertexFormat::Vertex material;     //color, specular, shininess and reflection of every vertex
+} Thread_args;
+
+//copy the material then set the position, the normal is the one of the ellipsoid at the point
+static inline void writeVertex(StandardVertexFormat::Vertex * v, float x, float y, float z, float nx, float ny, float nz, const StandardVertexFormat::Vertex * material)
+{
+    float len = sqrtf(nx * nx + ny * ny + nz * nz);
+    float inv = (len > 0.0f) ? 1.0f / len : 0.0f;
+
+    *v = *material;
+    v->set<0>(x, y, z);
+    v->set<1>(nx * inv, ny * inv, nz * inv);
+}
+
+static void drawParallel(Thread_args * t_args, unsigned int p)
+{
+    unsigned int m = t_args->m;
+    unsigned int n = t_args->n;
+    Sphere * s = t_args->s;
+
+    //parallels strictly between the poles
+    float theta = ( (float) p + 1) / ( (float) n + 1) * M_PI - M_PI/2;
+    float ct = cosf( theta );
+    float st = sinf( theta );
+
+    float x = s->rx * ct, y = s->ry * st, z = s->rz * ct;
+    float nx = ct / s->rx, ny = st / s->ry, nz = ct / s->rz;
+
+    const float * cos_a = t_args->cos_a;
+    const float * sin_a = t_args->sin_a;
+    StandardVertexFormat::Vertex * v = StandardVertexFormat::vertices(t_args->o) + p * m + 1;
+
+    for (unsigned int i = 0; i < m; i++)
+        writeVertex(v + i, x * cos_a[i], y, z * sin_a[i], nx * cos_a[i], ny, nz * sin_a[i], &t_args->material);
+}
+
+static void thread_drawParallels(unsigned int begin, unsigned int end, void * args)
+{
+    for (unsigned int p = begin; p < end; p++)
+        drawParallel((Thread_args *) args, p);
+}
+
+Object * Sphere_generateSurface(
+    Sphere * sphere,
+    unsigned short meridian,
+    unsigned short parallel,
+    Vec3 * color,
+    Vec3 * specular,
+    float reflection,
+    float shininess
+)
+{
+
+    //CREATE THE OBJECT (parallels between the poles, triangles shared by the spheres of same resolution)
+    Object * obj = StandardVertexFormat::initGrid( (unsigned int) meridian * parallel + 2, Object_gridIndices(parallel, meridian, GRID_POLES, 0) );
+
+    //ANGLES OF THE MERIDIANS, the same for every parallel
+    float * cos_a = (float *) malloc(2 * (size_t) meridian * sizeof(float));
+    if (!cos_a) {
+        fprintf(stderr, "Error: Memory allocation failed for sphere meridians.\n");
+        exit(EXIT_FAILURE);
+    }
+    float * sin_a = cos_a + meridian;
+
+    for (unsigned int i = 0; i < meridian; i++)
+    {
+        float alpha = ((float) i) / ((float) meridian) * 2 * M_PI;
+        cos_a[i] = cosf( alpha );
+        sin_a[i] = sinf( alpha );
+    }
+
+    Thread_args t_args;
+    t_args.m = meridian;
+    t_args.n = parallel;
+    t_args.o = obj;
+    t_args.s = sphere;
+    t_args.cos_a = cos_a;
+    t_args.sin_a = sin_a;
+
+    t_args.material = StandardVertex_material(color, specular, shininess, reflection);
+
+    //CREATE POLES (south first, north last)
+    StandardVertexFormat::Vertex * vertices = StandardVertexFormat::vertices(obj);
+    writeVertex(vertices, 0.0f, -sphere->ry, 0.0f, 0.0f, -1.0f, 0.0f, &t_args.material);
+    writeVertex(vertices + obj->n_points - 1, 0.0f, sphere->ry, 0.0f, 0.0f, 1.0f, 0.0f, &t_args.material);
+
+    //CREATE EACH PARALLELS
+    ThreadPool_parallelFor(0, parallel, 8, thread_drawParallels, (void *) &t_args);
+
+    free(cos_a);
+
+    float max[3] = { sphere->rx, sphere->ry, sphere->rz };
+    float min[3] = { -sphere->rx, -sphere->ry, -sphere->rz };
+    Object_setBounds(obj, min, max, fmaxf(sphere->rx, fmaxf(sphere->ry, sphere->rz)));
+
+    return obj;
+}
+
+//SUBDIVIDED SPHERES
+
+#define SUBDIVISION_ICOSAHEDRON 0
+#define SUBDIVISION_OCTAHEDRON 1
+
+/**
+ * @brief unit directions and triangles of a subdivided polyhedron, shared by every sphere of same base and level
+ */
+typedef struct subdivision_entry
+{
+    unsigned char base;
+    unsigned char level;
+    unsigned int n_vertices;
+    float * directions;         //3 floats per vertex, on the unit sphere
+    GridIndices g;              //rows, cols and wrap are 0 : not a grid
+    struct subdivision_entry * next;
+} subdivision_entry;
+
+static subdivision_entry * subdivision_cache = NULL;
+static pthread_mutex_t subdivision_lock = PTHREAD_MUTEX_INITIALIZER;
+
+/**
+ * @brief table of the edges already split, (a, b) with a < b gives the index of the midpoint
+ */
+typedef struct midpoint_table
+{
+    unsigned long long * keys;  //0 for an empty slot (the edge (0, 0) does not exist)
+    unsigned int * values;
+    unsigned int mask;
+} midpoint_table;
+
+static void midpoint_init(midpoint_table * t, unsigned int n_edges)
+{
+    unsigned int capacity = 16;
+    while (capacity < 2 * n_edges)
+        capacity *= 2;
+
+    t->mask = capacity - 1;
+    t->keys = (unsigned long long *) calloc(capacity, sizeof(unsigned long long));
+    t->values = (unsigned int *) calloc(capacity, sizeof(unsigned int));
+    if (!t->keys || !t->values) {
+        fprintf(stderr, "Error: Memory allocation failed for midpoint table.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+//index of the midpoint of (a, b), pushed on the unit sphere the first time the edge is seen
+static unsigned int midpoint_get(midpoint_table * t, float * directions, unsigned int * n_vertices, unsigned int a, unsigned int b)
+{
+    if (a > b)
+    {
+        unsigned int tmp = a;
+        a = b;
+        b = tmp;
+    }
+
+    unsigned long long key = ((unsigned long long) a << 32) | b;
+    unsigned int slot = (unsigned int) ((key * 0x9E3779B97F4A7C15ULL) >> 32) & t->mask;
+
+    while (t->keys[slot] != 0)
+    {
+        if (t->keys[slot] == key)
+            return t->values[slot];
+        slot = (slot + 1) & t->mask;
+    }
+
+    unsigned int m = (*n_vertices)++;
+    float x = directions[3 * a + 0] + directions[3 * b + 0];
+    float y = directions[3 * a + 1] + directions[3 * b + 1];
+    float z = directions[3 * a + 2] + directions[3 * b + 2];
+    float inv = 1.0f / sqrtf(x * x + y * y + z * z);
+
+    directions[3 * m + 0] = x * inv;
+    directions[3 * m + 1] = y * inv;
+    directions[3 * m + 2] = z * inv;
+
+    t->keys[slot] = key;
+    t->values[slot] = m;
+    return m;
+}
+
+//faces of the base polyhedron, counter clockwise seen from outside
+static unsigned int subdivision_base(unsigned char base, float * directions, unsigned int * faces)
+{
+    if (base == SUBDIVISION_ICOSAHEDRON)
+    {
+        const float t = (1.0f + sqrtf(5.0f)) / 2.0f;
+        const float v[12][3] = {
+            {-1,  t,  0}, { 1,  t,  0}, {-1, -t,  0}, { 1, -t,  0},
+            { 0, -1,  t}, { 0,  1,  t}, { 0, -1, -t}, { 0,  1, -t},
+            { t,  0, -1}, { t,  0,  1}, {-t,  0, -1}, {-t,  0,  1}
+        };
+        const unsigned int f[20][3] = {
+            {0, 11, 5}, {0, 5, 1}, {0, 1, 7}, {0, 7, 10}, {0, 10, 11},
+            {1, 5, 9}, {5, 11, 4}, {11, 10, 2}, {10, 7, 6}, {7, 1, 8},
+            {3, 9, 4}, {3, 4, 2}, {3, 2, 6}, {3, 6, 8}, {3, 8, 9},
+            {4, 9, 5}, {2, 4, 11}, {6, 2, 10}, {8, 6, 7}, {9, 8, 1}
+        };
+
+        float inv = 1.0f / sqrtf(1.0f + t * t);
+        for (unsigned int i = 0; i < 12; i++)
+            for (unsigned int k = 0; k < 3; k++)
+                directions[3 * i + k] = v[i][k] * inv;
+
+        memcpy(faces, f, sizeof(f));
+        return 12;
+    }
+
+    //octahedron : +x -x +y -y +z -z, one face per octant
+    memset(directions, 0, 18 * sizeof(float));
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        directions[3 * (2 * k) + k] = 1.0f;
+        directions[3 * (2 * k + 1) + k] = -1.0f;
+    }
+
+    for (unsigned int o = 0; o < 8; o++)
+    {
+        unsigned int x = (o & 1) ? 1 : 0, y = (o & 2) ? 3 : 2, z = (o & 4) ? 5 : 4;
+        unsigned int negatives = (o & 1) + ((o >> 1) & 1) + ((o >> 2) & 1);
+
+        faces[3 * o + 0] = x;
+        faces[3 * o + 1] = (negatives % 2) ? z : y;
+        faces[3 * o + 2] = (negatives % 2) ? y : z;
+    }
+
+    return 6;
+}
+
+static void subdivision_generate(subdivision_entry * e)
+{
+    unsigned int base_vertices = (e->base == SUBDIVISION_ICOSAHEDRON) ? 12 : 6;
+    unsigned int base_faces = (e->base == SUBDIVISION_ICOSAHEDRON) ? 20 : 8;
+    unsigned int n_faces = base_faces << (2 * e->level);
+
+    //V - E + F = 2 with E = 3F / 2
+    e->n_vertices = n_faces / 2 + 2;
+    e->directions = (float *) malloc(3 * (size_t) e->n_vertices * sizeof(float));
+
+    unsigned int * faces = (unsigned int *) malloc(3 * (size_t) n_faces * sizeof(unsigned int));
+    unsigned int * next = (unsigned int *) malloc(3 * (size_t) n_faces * sizeof(unsigned int));
+    if (!e->directions || !faces || !next) {
+        fprintf(stderr, "Error: Memory allocation failed for subdivided sphere.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int n_vertices = subdivision_base(e->base, e->directions, faces);
+    unsigned int count = base_faces;
+    if (n_vertices != base_vertices) {
+        fprintf(stderr, "Error: Invalid base solid for subdivided sphere (%u vertices, %u expected).\n", n_vertices, base_vertices);
+        exit(EXIT_FAILURE);
+    }
+
+    //each triangle is split in four, the midpoints are shared with the neighbour triangle
+    for (unsigned char l = 0; l < e->level; l++)
+    {
+        midpoint_table table;
+        midpoint_init(&table, 3 * count / 2);
+
+        for (unsigned int f = 0; f < count; f++)
+        {
+            unsigned int a = faces[3 * f + 0], b = faces[3 * f + 1], c = faces[3 * f + 2];
+            unsigned int ab = midpoint_get(&table, e->directions, &n_vertices, a, b);
+            unsigned int bc = midpoint_get(&table, e->directions, &n_vertices, b, c);
+            unsigned int ca = midpoint_get(&table, e->directions, &n_vertices, c, a);
+
+            unsigned int * t = next + 12 * f;
+            t[0] = a;  t[1]  = ab; t[2]  = ca;
+            t[3] = b;  t[4]  = bc; t[5]  = ab;
+            t[6] = c;  t[7]  = ca; t[8]  = bc;
+            t[9] = ab; t[10] = bc; t[11] = ca;
+        }
+
+        free(table.keys);
+        free(table.values);
+
+        unsigned int * tmp = faces;
+        faces = next;
+        next = tmp;
+        count *= 4;
+    }
+
+    free(next);
+
+    //every midpoint is shared by exactly two triangles, so the table must give back V = F / 2 + 2
+    if (n_vertices != e->n_vertices) {
+        fprintf(stderr, "Error: Subdivided sphere has %u vertices, %u expected.\n", n_vertices, e->n_vertices);
+        exit(EXIT_FAILURE);
+    }
+
+    e->g.count = 3 * n_faces;
+    if (e->g.index_size == 2)
+    {
+        unsigned short * data = (unsigned short *) malloc(e->g.count * sizeof(unsigned short));
+        if (!data) {
+            fprintf(stderr, "Error: Memory allocation failed for subdivided sphere.\n");
+            exit(EXIT_FAILURE);
+        }
+        for (unsigned int k = 0; k < e->g.count; k++)
+            data[k] = (unsigned short) faces[k];
+
+        free(faces);
+        e->g.data = data;
+    }
+    else
+        e->g.data = faces;
+}
+
+static subdivision_entry * subdivision_get(unsigned char base, unsigned char level, unsigned char index_size)
+{
+    if (level > SPHERE_MAX_SUBDIVISION) {
+        fprintf(stderr, "Error: Invalid subdivision level %u (at most %u).\n", level, SPHERE_MAX_SUBDIVISION);
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int n_vertices = (((base == SUBDIVISION_ICOSAHEDRON) ? 20u : 8u) << (2 * level)) / 2 + 2;
+    if (index_size == 0)
+        index_size = (n_vertices <= 65536) ? 2 : 4;
+
+    if ((index_size != 2 && index_size != 4) || (index_size == 2 && n_vertices > 65536)) {
+        fprintf(stderr, "Error: Invalid index size %u for %u vertices.\n", index_size, n_vertices);
+        exit(EXIT_FAILURE);
+    }
+
+    pthread_mutex_lock(&subdivision_lock);
+
+    subdivision_entry * e = subdivision_cache;
+    while (e && !(e->base == base && e->level == level && e->g.index_size == index_size))
+        e = e->next;
+
+    if (!e)
+    {
+        e = (subdivision_entry *) calloc(1, sizeof(subdivision_entry));
+        if (!e) {
+            fprintf(stderr, "Error: Memory allocation failed for subdivision cache.\n");
+            exit(EXIT_FAILURE);
+        }
+        e->base = base;
+        e->level = level;
+        e->g.index_size = index_size;
+        subdivision_generate(e);
+        e->next = subdivision_cache;
+        subdivision_cache = e;
+    }
+
+    pthread_mutex_unlock(&subdivision_lock);
+    return e;
+}
+
+typedef struct subdivision_args
+{
+    const float * directions;
+    StandardVertexFormat::Vertex * vertices;
+    Sphere * s;
+    StandardVertexFormat::Vertex material;
+} subdivision_args;
+
+static void thread_fn_subdivision(unsigned int begin, unsigned int end, void * args)
+{
+    subdivision_args * a = (subdivision_args *) args;
+    Sphere * s = a->s;
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        const float * d = a->directions + 3 * i;
+        writeVertex(a->vertices + i, s->rx * d[0], s->ry * d[1], s->rz * d[2], d[0] / s->rx, d[1] / s->ry, d[2] / s->rz, &a->material);
+    }
+}
+
+static Object * generateSubdivided(Sphere * sphere, unsigned char base, unsigned char subdivision, unsigned char index_size, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    subdivision_entry * e = subdivision_get(base, subdivision, index_size);
+
+    Object * obj = StandardVertexFormat::initGrid(e->n_vertices, &e->g);
+
+    subdivision_args args;
+    args.directions = e->directions;
+    args.vertices = StandardVertexFormat::vertices(obj);
+    args.s = sphere;
+
+    args.material = StandardVertex_material(color, specular, shininess, reflection);
+
+    ThreadPool_parallelFor(0, e->n_vertices, 4096, thread_fn_subdivision, (void *) &args);
+
+    float max[3] = { sphere->rx, sphere->ry, sphere->rz };
+    float min[3] = { -sphere->rx, -sphere->ry, -sphere->rz };
+    Object_setBounds(obj, min, max, fmaxf(sphere->rx, fmaxf(sphere->ry, sphere->rz)));
+
+    return obj;
+}
+
+Object * Sphere_generateIcosphere(Sphere * sphere, unsigned char subdivision, unsigned char index_size, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    return generateSubdivided(sphere, SUBDIVISION_ICOSAHEDRON, subdivision, index_size, color, specular, reflection, shininess);
+}
+
+Object * Sphere_generateOctasphere(Sphere * sphere, unsigned char subdivision, unsigned char index_size, Vec3 * color, Vec3 * specular, float reflection, float shininess)
+{
+    return generateSubdivided(sphere, SUBDIVISION_OCTAHEDRON, subdivision, index_size, color, specular, reflection, shininess);
+}
@@ -1,58 +1,109 @@
-/**
- * @file Sphere.h
- * @brief Header for struct Sphere
- * @author Antony Madaleno
- * @version 1.0
- * @date 20-09-2023
- *
- * Header pour les struct Spheres
- *
- */
-
-#pragma once
-
-#include "Vec.h"
-#include "Quaternion.h"
-#include "Object.h"
-
-typedef struct Sphere
-{
-    float rx;
-    float ry;
-    float rz;
-} Sphere;
-
-/**
- * @brief 
- * 
- * @param rx 
- * @param ry 
- * @param rz 
- * @return Sphere* 
- */
-Sphere * Sphere_init(float rx, float ry, float rz);
-
-/**
- * @brief 
- * 
- * @param sphere 
- * @param meridian 
- * @param parallel 
- * @param color 
- * @param specular 
- * @param reflection 
- * @param shininess 
- * @return Object *
- */
-Object * Sphere_generateSurface (
-
-    Sphere * sphere,
-    unsigned char meridian,
-    unsigned char parallel,
-    Vec3 * color,
-    Vec3 * specular,
-    float reflection,
-    float shininess
-
-);
-
+/**
+ * @file Sphere.h
+ * @brief Header for struct Sphere
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 20-09-2023
+ *
+ * Header pour les struct Spheres
+ *
+ */
+
+#pragma once
+
+#include "Vec.h"
+#include "Quaternion.h"
+#include "Object.h"
+
+#define SPHERE_MAX_SUBDIVISION 8
+
+typedef struct Sphere
+{
+    float rx;
+    float ry;
+    float rz;
+} Sphere;
+
+/**
+ * @brief 
+ * 
+ * @param rx 
+ * @param ry 
+ * @param rz 
+ * @return Sphere* 
+ */
+Sphere * Sphere_init(float rx, float ry, float rz);
+
+/**
+ * @brief 
+ * 
+ * @param sphere 
+ * @param meridian 
+ * @param parallel 
+ * @param color 
+ * @param specular 
+ * @param reflection 
+ * @param shininess 
+ * @return Object *
+ */
+Object * Sphere_generateSurface (
+
+    Sphere * sphere,
+    unsigned short meridian,
+    unsigned short parallel,
+    Vec3 * color,
+    Vec3 * specular,
+    float reflection,
+    float shininess
+
+);
+
+/**
+ * @brief sphere from a subdivided icosahedron, triangles of nearly the same area everywhere
+ * (10 * 4^subdivision + 2 vertices), the triangles are shared by the spheres of same subdivision
+ * 
+ * @param sphere 
+ * @param subdivision number of times each triangle is split in four (at most SPHERE_MAX_SUBDIVISION)
+ * @param index_size 2 or 4 bytes, 0 to use 16 bits indices whenever the vertex count allows it
+ * @param color 
+ * @param specular 
+ * @param reflection 
+ * @param shininess 
+ * @return Object* 
+ */
+Object * Sphere_generateIcosphere (
+
+    Sphere * sphere,
+    unsigned char subdivision,
+    unsigned char index_size,
+    Vec3 * color,
+    Vec3 * specular,
+    float reflection,
+    float shininess
+
+);
+
+/**
+ * @brief sphere from a subdivided octahedron (4 * 4^subdivision + 2 vertices), its poles and equator
+ * are vertices so it splits exactly in hemispheres and octants
+ * 
+ * @param sphere 
+ * @param subdivision number of times each triangle is split in four (at most SPHERE_MAX_SUBDIVISION)
+ * @param index_size 2 or 4 bytes, 0 to use 16 bits indices whenever the vertex count allows it
+ * @param color 
+ * @param specular 
+ * @param reflection 
+ * @param shininess 
+ * @return Object* 
+ */
+Object * Sphere_generateOctasphere (
+
+    Sphere * sphere,
+    unsigned char subdivision,
+    unsigned char index_size,
+    Vec3 * color,
+    Vec3 * specular,
+    float reflection,
+    float shininess
+
+);
\ No newline at end of file
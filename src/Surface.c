@@ -1,202 +1,1184 @@
-#include "Surface.h"
-#include <stdio.h>
-#include <stdlib.h>
-#include <pthread.h>
-#include <math.h>
-#include <string.h>
-
-Surface3D * Surface3D_init( 
-    Vec3 ** control_points,
-    const unsigned char u_control_count,
-    const unsigned char v_control_count,
-    const unsigned short u_count, 
-    const unsigned short v_count, 
-    const enum methode mode_u, 
-    const enum methode mode_v
-)
-{
-
-    //Allocation du pointeur mémoire pour la surface
-    Surface3D * surface = (Surface3D *) calloc(1, sizeof(Surface3D) );
-    if (!surface) {
-        fprintf(stderr, "Error: Memory allocation failed for Surface3D.\n");
-        return NULL;
-    }
-
-    //on définie le nombre de point qui définiront la surface en fonction des directions u et v
-    surface->N = u_count;
-    surface->M = v_count;
-
-    //Allocation du buffer de stockage des information de coordonnées
-    surface->data = (float *) calloc((surface->N * surface->M * 3), sizeof(float) );
-    if (!surface->data) {
-        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    //Allocation des buffer pour stocker les tangeantes et les normals
-    surface->Tu = (Vec3 **) calloc(surface->N, sizeof(Vec3*));
-    if (!surface->Tu) {
-        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    surface->Tv = (Vec3 **) calloc(surface->N, sizeof(Vec3*));
-    if (!surface->Tv) {
-        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    surface->normals = (Vec3 **) calloc(surface->N, sizeof(Vec3*) );
-    if (!surface->normals) {
-        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    //Allocation du buffer pour les points évaluer qui serviront de point de controle dans la prochaine étape
-    Vec3 ** controls = ( Vec3 ** ) calloc(v_control_count, sizeof( Vec3 * ) );
-    if (!controls) {
-        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    // Pour chaque point de controle dans la direction v
-    for (unsigned char v = 0; v < v_control_count; v++)
-    {
-        // on récupère le pointeur vers les point de controles actuels
-        Vec3 * current = control_points[v];
-
-        // évaluation de la courbe
-        Curve3D * c = Curve3D_init(current, u_control_count, surface->N, mode_u);
-
-        //Allocation de la mémoire pour le stockage des points
-        controls[v] = (Vec3 * ) calloc(surface->N, sizeof(Vec3) );
-        if (!controls[v]) {
-            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-            exit(EXIT_FAILURE);
-        }
-
-        //Conversion des donnée du buffer de la courbes en point Vec3
-        for (unsigned short i = 0; i < surface->N; i++)
-        {
-            controls[v][i].x = c->data[i * 3 + 0];
-            controls[v][i].y = c->data[i * 3 + 1];
-            controls[v][i].z = c->data[i * 3 + 2];
-        }
-    }
-
-    //for each calculated spline in u direction based on v we generate the points of our surface
-    for (unsigned char u = 0; u < surface->N; u++)
-    {
-
-        Vec3 * current_controls = (Vec3 *) calloc(v_control_count, sizeof(Vec3));
-        if (!current_controls) {
-            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-            exit(EXIT_FAILURE);
-        }
-
-
-        for (unsigned char v = 0; v < v_control_count; v++)
-            current_controls[v] = controls[v][u];
-
-        Curve3D * c = Curve3D_init(current_controls, v_control_count, surface->M, mode_v);
-
-        Curve3D_calculateTNB(c);
-
-        surface->Tv[u] = (Vec3 *) calloc(surface->M, sizeof(Vec3) );
-        if (!surface->Tv[u]) {
-            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-            exit(EXIT_FAILURE);
-        }
-
-        surface->Tu[u] = (Vec3 *) calloc( surface->M, sizeof(Vec3));
-        if (!surface->Tu[u]) {
-            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-            exit(EXIT_FAILURE);
-        }
-
-        surface->normals[u] = (Vec3 *) calloc(surface->M, sizeof(Vec3) );
-        if (!surface->normals[u]) {
-            fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
-            exit(EXIT_FAILURE);
-        }
-
-        memcpy(surface->data + u * surface->M * 3, c->data, sizeof(float) * c->npoints * 3 );
-        memcpy(surface->Tv[u],      c->T, sizeof(Vec3) * surface->M );
-        memcpy(surface->Tu[u],      c->B, sizeof(Vec3) * surface->M );
-        memcpy(surface->normals[u], c->N, sizeof(Vec3) * surface->M );
-    }
-
-    return surface;
-
-}
-
-
-
-Object * Surface3D_obejctify(Surface3D * s, Vec3 * color, Vec3 * specular_color, float shininess, float reflection)
-{
-
-    unsigned char * layout = (unsigned char *) calloc(6, sizeof(unsigned char));
-    if (!layout) {
-        fprintf(stderr, "Error: Memory allocation failed for layout.\n");
-        exit(EXIT_FAILURE);
-    }
-
-    layout[0] = 3;
-    layout[1] = 3;
-    layout[2] = 3;
-    layout[3] = 3;
-    layout[4] = 1;
-    layout[5] = 1;
-
-    unsigned char layout_size = 14;
-
-    Object * obj = Object_init( 
-        ( (unsigned int) s->N ) * ( (unsigned int) s->M ), 
-        6, layout,
-        ((unsigned int) s->N - 1) * ((unsigned int) s->M - 1) * 2
-    );
-
-    for (unsigned short i = 0; i < s->N; i++)
-    {
-        for (unsigned short j = 0; j < s->M; j++)
-        {
-            //POSITION
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 0] = s->data[3 * (i * s->M + j) + 0];
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 1] = s->data[3 * (i * s->M + j) + 1];
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 2] = s->data[3 * (i * s->M + j) + 2];
-
-            //NORMAL
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 3] = s->normals[i][j].x;
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 4] = s->normals[i][j].y;
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 5] = s->normals[i][j].z;
-
-            //COLORS PARAMETERS
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 6] = color->x;
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 7] = color->y;
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 8] = color->z;
-
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 9]  = specular_color->x;
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 10] = specular_color->y;
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 11] = specular_color->z;
-
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 12] = shininess;
-            obj->vertexBuffer[layout_size * (i * s->M + j) + 13] = reflection;
-
-            if (i < s->N - 2 && j < s->M - 2)
-            {
-                obj->indexBuffer[(i * s->M + j) * 6 + 0] = i * s->M + j;
-                obj->indexBuffer[(i * s->M + j) * 6 + 1] = (i+1) * s->M + j;
-                obj->indexBuffer[(i * s->M + j) * 6 + 2] = (i+1) * s->M + ( (j+1) % s->M );
-
-                obj->indexBuffer[(i * s->M + j) * 6 + 3] = i * s->M + j;
-                obj->indexBuffer[(i * s->M + j) * 6 + 4] = (i+1) * s->M + ( (j+1) % s->M );
-                obj->indexBuffer[(i * s->M + j) * 6 + 5] = i * s->M + ( (j+1) % s->M );
-            }
-
-        }
-    }
-
-    return obj;
-
+#include "Surface.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include "ThreadPool.h"
+#include "VertexFormat.hpp"
+#include <pthread.h>
+#include <math.h>
+#include <string.h>
+
+#ifdef _WIN32
+#include <malloc.h>
+#endif
+
+#define SURFACE_PLANES 12
+#define SURFACE_ALIGN 64
+
+typedef struct surface_args
+{
+    Surface3D * surface;
+    Matrix * Bu;
+    Matrix * dBu;
+    float * Q;
+    float * dQ;
+    unsigned int u_control_count;
+    Object * obj;
+    StandardVertexFormat::Vertex material;     //color, specular, shininess and reflection of every vertex
+} surface_args;
+
+// planes from the arena when there is one, its allocations are already aligned on 64 bytes
+static float * aligned_planes(Arena * arena, size_t count)
+{
+    if (arena)
+        return (float *) Arena_alloc(arena, count, sizeof(float));
+
+    float * block = NULL;
+#ifdef _WIN32
+    block = (float *) _aligned_malloc(count * sizeof(float), SURFACE_ALIGN);
+#else
+    if (posix_memalign((void **) &block, SURFACE_ALIGN, count * sizeof(float)) != 0)
+        block = NULL;
+#endif
+    return block;
+}
+
+// unit vector in place on a row of planes
+static void normalize_row(float * x, float * y, float * z, unsigned int M)
+{
+    for (unsigned int j = 0; j < M; j++)
+    {
+        float l2 = x[j] * x[j] + y[j] * y[j] + z[j] * z[j];
+        float inv = (l2 > 0.0f) ? 1.0f / sqrtf(l2) : 0.0f;
+        x[j] *= inv;
+        y[j] *= inv;
+        z[j] *= inv;
+    }
+}
+
+// S = Bu . Q, dS/du = Bu' . Q and dS/dv = Bu . Q' for the rows [begin, end[
+// Q and Q' hold P^T . Bv^T and P^T . Bv'^T per coordinate (x, y then z planes)
+static void thread_fn_rows(unsigned int begin, unsigned int end, void * args)
+{
+    surface_args * s_args = (surface_args *) args;
+    Surface3D * surface = s_args->surface;
+    unsigned int M = surface->M;
+    unsigned int cu = s_args->u_control_count;
+    size_t plane = (size_t) cu * M;
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        const float * bu = s_args->Bu->data + (size_t) i * cu;
+        const float * dbu = s_args->dBu->data + (size_t) i * cu;
+        size_t r = (size_t) i * surface->stride;
+
+        float * px = surface->x + r;
+        float * py = surface->y + r;
+        float * pz = surface->z + r;
+        float * ux = surface->tux + r;
+        float * uy = surface->tuy + r;
+        float * uz = surface->tuz + r;
+        float * vx = surface->tvx + r;
+        float * vy = surface->tvy + r;
+        float * vz = surface->tvz + r;
+
+        for (unsigned int j = 0; j < M; j++)
+        {
+            px[j] = 0.0f; py[j] = 0.0f; pz[j] = 0.0f;
+            ux[j] = 0.0f; uy[j] = 0.0f; uz[j] = 0.0f;
+            vx[j] = 0.0f; vy[j] = 0.0f; vz[j] = 0.0f;
+        }
+
+        //positions and both partial derivatives in the same pass over contiguous rows
+        for (unsigned int u = 0; u < cu; u++)
+        {
+            float w = bu[u];
+            float dw = dbu[u];
+            if (w == 0.0f && dw == 0.0f)
+                continue;
+
+            const float * qx = s_args->Q + u * M;
+            const float * qy = qx + plane;
+            const float * qz = qy + plane;
+            const float * dqx = s_args->dQ + u * M;
+            const float * dqy = dqx + plane;
+            const float * dqz = dqy + plane;
+
+            for (unsigned int j = 0; j < M; j++)
+            {
+                px[j] += w * qx[j];
+                py[j] += w * qy[j];
+                pz[j] += w * qz[j];
+
+                ux[j] += dw * qx[j];
+                uy[j] += dw * qy[j];
+                uz[j] += dw * qz[j];
+
+                vx[j] += w * dqx[j];
+                vy[j] += w * dqy[j];
+                vz[j] += w * dqz[j];
+            }
+        }
+
+        //normal = dS/du x dS/dv
+        float * nx = surface->nx + r;
+        float * ny = surface->ny + r;
+        float * nz = surface->nz + r;
+
+        for (unsigned int j = 0; j < M; j++)
+        {
+            nx[j] = uy[j] * vz[j] - uz[j] * vy[j];
+            ny[j] = uz[j] * vx[j] - ux[j] * vz[j];
+            nz[j] = ux[j] * vy[j] - uy[j] * vx[j];
+        }
+
+        normalize_row(nx, ny, nz, M);
+    }
+}
+
+// single allocation copy, rows in v
+static Vec3 ** copy_controls(Arena * arena, Vec3 ** control_points, unsigned int cu, unsigned int cv)
+{
+    Vec3 ** rows = (Vec3 **) Arena_alloc(arena, cv, sizeof(Vec3 *));
+    Vec3 * points = (Vec3 *) Arena_alloc(arena, (size_t) cu * cv, sizeof(Vec3));
+
+    for (unsigned int v = 0; v < cv; v++)
+    {
+        rows[v] = points + (size_t) v * cu;
+        memcpy(rows[v], control_points[v], cu * sizeof(Vec3));
+    }
+
+    return rows;
+}
+
+static void free_controls(Arena * arena, Vec3 ** rows)
+{
+    if (!rows)
+        return;
+    Arena_release(arena, rows[0]);
+    Arena_release(arena, rows);
+}
+
+// Q = P^T . B^T with B the basis in v, stored as x, y then z planes of cu rows of M values
+static void control_rows(Vec3 ** control_points, Matrix * Bv, unsigned int cu, unsigned int cv, unsigned int M, float * Q)
+{
+    size_t plane = (size_t) cu * M;
+
+    for (unsigned int u = 0; u < cu; u++)
+        for (unsigned int j = 0; j < M; j++)
+        {
+            const float * bv = Bv->data + (size_t) j * cv;
+            float x = 0.0f, y = 0.0f, z = 0.0f;
+
+            for (unsigned int v = 0; v < cv; v++)
+            {
+                x += bv[v] * control_points[v][u].x;
+                y += bv[v] * control_points[v][u].y;
+                z += bv[v] * control_points[v][u].z;
+            }
+
+            Q[(size_t) u * M + j] = x;
+            Q[plane + (size_t) u * M + j] = y;
+            Q[2 * plane + (size_t) u * M + j] = z;
+        }
+}
+
+Surface3D * Surface3D_init( 
+    Vec3 ** control_points,
+    const unsigned int u_control_count,
+    const unsigned int v_control_count,
+    const unsigned short u_count, 
+    const unsigned short v_count, 
+    const enum methode mode_u, 
+    const enum methode mode_v
+)
+{
+
+    //Allocation du pointeur mémoire pour la surface
+    Arena * arena = Arena_current();
+    Surface3D * surface = (Surface3D *) Arena_alloc(arena, 1, sizeof(Surface3D) );
+    surface->arena = arena;
+
+    //on définie le nombre de point qui définiront la surface en fonction des directions u et v
+    surface->N = u_count;
+    surface->M = v_count;
+
+    //matrices de base (partagées) et de leurs dérivées dans les directions u et v
+    Matrix * Bu  = Curve3D_basisMatrix(u_control_count, surface->N, mode_u, 0);
+    Matrix * dBu = Curve3D_basisMatrix(u_control_count, surface->N, mode_u, 1);
+    Matrix * Bv  = Curve3D_basisMatrix(v_control_count, surface->M, mode_v, 0);
+    Matrix * dBv = Curve3D_basisMatrix(v_control_count, surface->M, mode_v, 1);
+    if (!Bu || !dBu || !Bv || !dBv) {
+        Arena_release(arena, surface);
+        return NULL;
+    }
+
+    //Allocation d'un seul bloc aligné pour tous les plans, chaque ligne commence sur 64 octets
+    unsigned int align = SURFACE_ALIGN / sizeof(float);
+    surface->stride = (surface->M + align - 1) / align * align;
+
+    size_t plane = (size_t) surface->N * surface->stride;
+    surface->block = aligned_planes(arena, SURFACE_PLANES * plane);
+    if (!surface->block) {
+        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
+        exit(EXIT_FAILURE);
+    }
+    memset(surface->block, 0, SURFACE_PLANES * plane * sizeof(float));
+
+    surface->x   = surface->block;
+    surface->y   = surface->block + plane;
+    surface->z   = surface->block + 2 * plane;
+    surface->nx  = surface->block + 3 * plane;
+    surface->ny  = surface->block + 4 * plane;
+    surface->nz  = surface->block + 5 * plane;
+    surface->tux = surface->block + 6 * plane;
+    surface->tuy = surface->block + 7 * plane;
+    surface->tuz = surface->block + 8 * plane;
+    surface->tvx = surface->block + 9 * plane;
+    surface->tvy = surface->block + 10 * plane;
+    surface->tvz = surface->block + 11 * plane;
+
+    // Q = P^T . Bv^T et Q' = P^T . Bv'^T : pour chaque point de controle en u, la courbe en v (et sa dérivée) évaluée sur M points
+    unsigned int cu = u_control_count;
+    unsigned int cv = v_control_count;
+    unsigned int M = surface->M;
+
+    float * Q = (float *) calloc(6 * (size_t) cu * M, sizeof(float));
+    if (!Q) {
+        fprintf(stderr, "Error: Memory allocation failed for buffer array.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    control_rows(control_points, Bv, cu, cv, M, Q);
+    control_rows(control_points, dBv, cu, cv, M, Q + 3 * (size_t) cu * M);
+
+    // S = Bu . Q, dS/du = Bu' . Q, dS/dv = Bu . Q', par blocs de lignes
+    surface_args s_args;
+    s_args.surface = surface;
+    s_args.Bu = Bu;
+    s_args.dBu = dBu;
+    s_args.Q = Q;
+    s_args.dQ = Q + 3 * (size_t) cu * M;
+    s_args.u_control_count = cu;
+
+    ThreadPool_parallelFor(0, surface->N, 8, thread_fn_rows, (void *) &s_args);
+
+    free(Q);
+
+    //copie gardée pour les mises à jour locales
+    surface->control_points = copy_controls(surface->arena, control_points, cu, cv);
+    surface->u_control_count = cu;
+    surface->v_control_count = cv;
+    surface->mode_u = mode_u;
+    surface->mode_v = mode_v;
+
+    return surface;
+
+}
+
+// vertices of the rows [begin, end[ written in order, each plane is read sequentially
+static void thread_fn_objectify(unsigned int begin, unsigned int end, void * args)
+{
+    surface_args * s_args = (surface_args *) args;
+    Surface3D * s = s_args->surface;
+    StandardVertexFormat::Vertex * vertices = StandardVertexFormat::vertices(s_args->obj);
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        size_t r = (size_t) i * s->stride;
+        StandardVertexFormat::Vertex * v = vertices + (size_t) i * s->M;
+
+        for (unsigned int j = 0; j < s->M; j++)
+        {
+            v[j] = s_args->material;
+            v[j].set<0>(s->x[r + j], s->y[r + j], s->z[r + j]);
+            v[j].set<1>(s->nx[r + j], s->ny[r + j], s->nz[r + j]);
+        }
+    }
+}
+
+// box of the position planes over the rows [i0, i1[ and columns [j0, j1[ (contiguous rows, no vertex read back)
+static void surface_box(const Surface3D * s, unsigned int i0, unsigned int i1, unsigned int j0, unsigned int j1, float * min, float * max)
+{
+    const float * planes[3] = { s->x, s->y, s->z };
+
+    for (unsigned int k = 0; k < 3; k++)
+    {
+        float lo = INFINITY, hi = -INFINITY;
+        for (unsigned int i = i0; i < i1; i++)
+        {
+            const float * row = planes[k] + (size_t) i * s->stride;
+            for (unsigned int j = j0; j < j1; j++)
+            {
+                lo = fminf(lo, row[j]);
+                hi = fmaxf(hi, row[j]);
+            }
+        }
+        min[k] = lo;
+        max[k] = hi;
+    }
+}
+
+static void surface_bounds(const Surface3D * s, Object * obj)
+{
+    float min[3], max[3];
+    surface_box(s, 0, s->N, 0, s->M, min, max);
+
+    if (s->N > 0 && s->M > 0)
+        Object_setBounds(obj, min, max, 0.0f);
+}
+
+Object * Surface3D_obejctify(Surface3D * s, Vec3 * color, Vec3 * specular_color, float shininess, float reflection)
+{
+
+    //triangles partagés par toutes les surfaces de même résolution
+    Object * obj = StandardVertexFormat::initGrid( 
+        ( (unsigned int) s->N ) * ( (unsigned int) s->M ), 
+        Object_gridIndices(s->N, s->M, GRID_OPEN, 0)
+    );
+
+    surface_args s_args;
+    s_args.surface = s;
+    s_args.obj = obj;
+    s_args.material = StandardVertex_material(color, specular_color, shininess, reflection);
+
+    ThreadPool_parallelFor(0, s->N, 16, thread_fn_objectify, (void *) &s_args);
+    surface_bounds(s, obj);
+
+    return obj;
+
+}
+
+typedef struct update_args
+{
+    Surface3D * surface;
+    Surface3DRect rect;
+    Vec3 d;             //move of the control point
+    float * bu, * dbu;  //column u of Bu and Bu' on the rows of the rectangle
+    float * bv, * dbv;  //column v of Bv and Bv' on the columns of the rectangle
+} update_args;
+
+// rank 1 update of the rows [begin, end[ of the rectangle, then their normals
+static void thread_fn_update(unsigned int begin, unsigned int end, void * args)
+{
+    update_args * u_args = (update_args *) args;
+    Surface3D * s = u_args->surface;
+    Surface3DRect rect = u_args->rect;
+    Vec3 d = u_args->d;
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        float a = u_args->bu[i - rect.i0];
+        float da = u_args->dbu[i - rect.i0];
+        size_t r = (size_t) i * s->stride;
+
+        for (unsigned int j = rect.j0; j < rect.j1; j++)
+        {
+            float b = u_args->bv[j - rect.j0];
+            float db = u_args->dbv[j - rect.j0];
+            size_t k = r + j;
+
+            s->x[k] += a * b * d.x;
+            s->y[k] += a * b * d.y;
+            s->z[k] += a * b * d.z;
+
+            s->tux[k] += da * b * d.x;
+            s->tuy[k] += da * b * d.y;
+            s->tuz[k] += da * b * d.z;
+
+            s->tvx[k] += a * db * d.x;
+            s->tvy[k] += a * db * d.y;
+            s->tvz[k] += a * db * d.z;
+
+            s->nx[k] = s->tuy[k] * s->tvz[k] - s->tuz[k] * s->tvy[k];
+            s->ny[k] = s->tuz[k] * s->tvx[k] - s->tux[k] * s->tvz[k];
+            s->nz[k] = s->tux[k] * s->tvy[k] - s->tuy[k] * s->tvx[k];
+        }
+
+        normalize_row(s->nx + r + rect.j0, s->ny + r + rect.j0, s->nz + r + rect.j0, rect.j1 - rect.j0);
+    }
+}
+
+// rows of a basis where the column c (or its derivative) is not zero : the support of the control point c
+static void basis_support(const Matrix * B, const Matrix * dB, unsigned int c, unsigned int n, unsigned short * first, unsigned short * last)
+{
+    unsigned int k = B->n_cols;
+    *first = 0;
+    *last = 0;
+
+    unsigned int i = 0;
+    while (i < n && B->data[(size_t) i * k + c] == 0.0f && dB->data[(size_t) i * k + c] == 0.0f)
+        i++;
+    if (i == n)
+        return;
+
+    unsigned int j = n;
+    while (B->data[(size_t) (j - 1) * k + c] == 0.0f && dB->data[(size_t) (j - 1) * k + c] == 0.0f)
+        j--;
+
+    *first = (unsigned short) i;
+    *last = (unsigned short) j;
+}
+
+// column c of a basis on the rows [first, last[ as a contiguous array
+static float * basis_column(const Matrix * B, unsigned int c, unsigned int first, unsigned int last)
+{
+    float * col = (float *) calloc(last - first, sizeof(float));
+    if (!col) {
+        fprintf(stderr, "Error: Memory allocation failed for basis column.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (unsigned int i = first; i < last; i++)
+        col[i - first] = B->data[(size_t) i * B->n_cols + c];
+
+    return col;
+}
+
+Surface3DRect Surface3D_updateControlPoint(Surface3D * s, unsigned int u, unsigned int v, Vec3 * p)
+{
+    Surface3DRect rect;
+    rect.i0 = rect.i1 = 0;
+    rect.j0 = rect.j1 = 0;
+
+    if (!s || !p || !s->control_points || u >= s->u_control_count || v >= s->v_control_count) {
+        fprintf(stderr, "Error: Invalid input arguments for surface control point update.\n");
+        return rect;
+    }
+
+    Vec3 d;
+    Vec3_set(&d, p->x - s->control_points[v][u].x, p->y - s->control_points[v][u].y, p->z - s->control_points[v][u].z);
+    s->control_points[v][u] = *p;
+
+    if (d.x == 0.0f && d.y == 0.0f && d.z == 0.0f)
+        return rect;
+
+    Matrix * Bu  = Curve3D_basisMatrix(s->u_control_count, s->N, s->mode_u, 0);
+    Matrix * dBu = Curve3D_basisMatrix(s->u_control_count, s->N, s->mode_u, 1);
+    Matrix * Bv  = Curve3D_basisMatrix(s->v_control_count, s->M, s->mode_v, 0);
+    Matrix * dBv = Curve3D_basisMatrix(s->v_control_count, s->M, s->mode_v, 1);
+    if (!Bu || !dBu || !Bv || !dBv)
+        return rect;
+
+    //Bezier : tout le carreau, Catmull-Rom : les segments qui utilisent le point
+    basis_support(Bu, dBu, u, s->N, &rect.i0, &rect.i1);
+    basis_support(Bv, dBv, v, s->M, &rect.j0, &rect.j1);
+    if (rect.i0 == rect.i1 || rect.j0 == rect.j1)
+    {
+        rect.i0 = rect.i1 = 0;
+        rect.j0 = rect.j1 = 0;
+        return rect;
+    }
+
+    update_args u_args;
+    u_args.surface = s;
+    u_args.rect = rect;
+    u_args.d = d;
+    u_args.bu  = basis_column(Bu, u, rect.i0, rect.i1);
+    u_args.dbu = basis_column(dBu, u, rect.i0, rect.i1);
+    u_args.bv  = basis_column(Bv, v, rect.j0, rect.j1);
+    u_args.dbv = basis_column(dBv, v, rect.j0, rect.j1);
+
+    ThreadPool_parallelFor(rect.i0, rect.i1, 16, thread_fn_update, (void *) &u_args);
+
+    free(u_args.bu);
+    free(u_args.dbu);
+    free(u_args.bv);
+    free(u_args.dbv);
+
+    return rect;
+}
+
+// positions and normals of the samples of rect, the material of the vertices is kept
+template <typename Format>
+static void surface_update(Surface3D * s, Object * obj, Surface3DRect rect)
+{
+    typename Format::Vertex * vertices = Format::vertices(obj);
+
+    for (unsigned int i = rect.i0; i < rect.i1; i++)
+    {
+        size_t r = (size_t) i * s->stride;
+        typename Format::Vertex * v = vertices + (size_t) i * s->M;
+
+        for (unsigned int j = rect.j0; j < rect.j1; j++)
+        {
+            v[j].template set<0>(s->x[r + j], s->y[r + j], s->z[r + j]);
+            v[j].template set<1>(s->nx[r + j], s->ny[r + j], s->nz[r + j]);
+        }
+    }
+}
+
+Curve3DRange Surface3D_updateObject(Surface3D * s, Object * obj, Surface3DRect rect)
+{
+    Curve3DRange vertices;
+    vertices.begin = 0;
+    vertices.end = 0;
+
+    if (!s || !obj || rect.i0 >= rect.i1 || rect.j0 >= rect.j1)
+        return vertices;
+
+    if (obj->types) {
+        fprintf(stderr, "Error: A quantized object can not be updated.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    if (CompactVertexFormat::matches(obj))
+        surface_update<CompactVertexFormat>(s, obj, rect);
+    else
+        surface_update<StandardVertexFormat>(s, obj, rect);
+
+    //only the moved samples are read, the bounds grow to hold them
+    float min[3], max[3];
+    surface_box(s, rect.i0, rect.i1, rect.j0, rect.j1, min, max);
+    Object_growBounds(obj, min, max);
+
+    vertices.begin = rect.i0 * s->M + rect.j0;
+    vertices.end = (rect.i1 - 1) * s->M + rect.j1;
+
+    return vertices;
+}
+
+void Surface3D_free(Surface3D * s)
+{
+    if (!s || s->arena)
+        return;
+
+#ifdef _WIN32
+    _aligned_free(s->block);
+#else
+    free(s->block);
+#endif
+    free_controls(NULL, s->control_points);
+    free(s);
+}
+
+// (i, j) of the point k of an edge line, depth 0 is the edge itself and depth 1 the line inside
+static void edge_point(unsigned char edge, unsigned int n, unsigned int k, unsigned int depth, unsigned int * i, unsigned int * j)
+{
+    switch (edge)
+    {
+    case 0: *i = depth;     *j = k;         break;
+    case 1: *i = n - depth; *j = k;         break;
+    case 2: *i = k;         *j = depth;     break;
+    default: *i = k;        *j = n - depth; break;
+    }
+}
+
+// write a triangle of the grid with the same winding as the interior cells
+static unsigned int emit_triangle(unsigned int * indices, unsigned int n, const unsigned int i[3], const unsigned int j[3])
+{
+    int area = ((int) i[1] - (int) i[0]) * ((int) j[2] - (int) j[0]) - ((int) j[1] - (int) j[0]) * ((int) i[2] - (int) i[0]);
+
+    indices[0] = i[0] * (n + 1) + j[0];
+    indices[1] = (area > 0 ? i[1] : i[2]) * (n + 1) + (area > 0 ? j[1] : j[2]);
+    indices[2] = (area > 0 ? i[2] : i[1]) * (n + 1) + (area > 0 ? j[2] : j[1]);
+
+    return 3;
+}
+
+// zip the edge (every step points) with the line inside it (points 1 to n - 1), the corner cells are shared with the next edges
+static unsigned int stitch_edge(unsigned int * indices, unsigned int n, unsigned char edge, unsigned int step)
+{
+    unsigned int count = 0;
+    unsigned int ka = 0, kb = 1;
+    unsigned int i[3], j[3];
+
+    while (ka < n || kb < n - 1)
+    {
+        if (ka < n && (kb == n - 1 || ka + step <= kb + 1))
+        {
+            edge_point(edge, n, ka, 0, &i[0], &j[0]);
+            edge_point(edge, n, ka + step, 0, &i[1], &j[1]);
+            edge_point(edge, n, kb, 1, &i[2], &j[2]);
+            ka += step;
+        }
+        else
+        {
+            edge_point(edge, n, ka, 0, &i[0], &j[0]);
+            edge_point(edge, n, kb + 1, 1, &i[1], &j[1]);
+            edge_point(edge, n, kb, 1, &i[2], &j[2]);
+            kb++;
+        }
+        count += emit_triangle(indices + count, n, i, j);
+    }
+
+    return count;
+}
+
+static void lod_level(Surface3DLODLevel * l, unsigned char level)
+{
+    unsigned int n = 1u << level;
+
+    l->indices = (unsigned int *) calloc(3 * (2 * n * n + 8 * n), sizeof(unsigned int));
+    if (!l->indices) {
+        fprintf(stderr, "Error: Memory allocation failed for LOD index buffer.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int count = 0;
+
+    //a single cell has no inside line, its edges can not be coarser
+    unsigned int lo = (n == 1) ? 0 : 1;
+    unsigned int hi = (n == 1) ? 1 : n - 1;
+
+    l->first[0] = 0;
+    for (unsigned int i = lo; i < hi; i++)
+        for (unsigned int j = lo; j < hi; j++)
+        {
+            l->indices[count++] = i * (n + 1) + j;
+            l->indices[count++] = (i+1) * (n + 1) + j;
+            l->indices[count++] = (i+1) * (n + 1) + (j+1);
+
+            l->indices[count++] = i * (n + 1) + j;
+            l->indices[count++] = (i+1) * (n + 1) + (j+1);
+            l->indices[count++] = i * (n + 1) + (j+1);
+        }
+    l->count[0] = count;
+
+    for (unsigned char edge = 0; edge < 4; edge++)
+        for (unsigned char stitched = 0; stitched < 2; stitched++)
+        {
+            unsigned char r = 1 + 2 * edge + stitched;
+            l->first[r] = count;
+            if (n > 1)
+                count += stitch_edge(l->indices + count, n, edge, stitched ? 2 : 1);
+            l->count[r] = count - l->first[r];
+        }
+}
+
+Surface3DLOD * Surface3DLOD_init(unsigned char max_level)
+{
+    if (max_level > SURFACE_LOD_MAX_LEVEL)
+        max_level = SURFACE_LOD_MAX_LEVEL;
+
+    Surface3DLOD * lod = (Surface3DLOD *) calloc(1, sizeof(Surface3DLOD));
+    if (!lod) {
+        fprintf(stderr, "Error: Memory allocation failed for Surface3DLOD.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    lod->max_level = max_level;
+    lod->levels = (Surface3DLODLevel *) calloc(max_level + 1, sizeof(Surface3DLODLevel));
+    if (!lod->levels) {
+        fprintf(stderr, "Error: Memory allocation failed for LOD levels.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (unsigned char level = 0; level <= max_level; level++)
+        lod_level(&lod->levels[level], level);
+
+    lod->stitched = (GridIndices *) calloc(16 * (max_level + 1), sizeof(GridIndices));
+    if (!lod->stitched) {
+        fprintf(stderr, "Error: Memory allocation failed for LOD index buffers.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return lod;
+}
+
+unsigned int Surface3DLOD_gather(const Surface3DLOD * lod, unsigned char level, unsigned char mask, unsigned int * indices)
+{
+    if (level > lod->max_level) {
+        fprintf(stderr, "Error: LOD level %u is above the max level %u.\n", level, lod->max_level);
+        exit(EXIT_FAILURE);
+    }
+
+    const Surface3DLODLevel * l = &lod->levels[level];
+    unsigned char ranges[5];
+    ranges[0] = 0;
+    for (unsigned char edge = 0; edge < 4; edge++)
+        ranges[1 + edge] = 1 + 2 * edge + ((mask >> edge) & 1);
+
+    unsigned int count = 0;
+    for (unsigned char r = 0; r < 5; r++)
+    {
+        if (indices)
+            memcpy(indices + count, l->indices + l->first[ranges[r]], l->count[ranges[r]] * sizeof(unsigned int));
+        count += l->count[ranges[r]];
+    }
+
+    return count;
+}
+
+static pthread_mutex_t lod_lock = PTHREAD_MUTEX_INITIALIZER;
+
+GridIndices * Surface3DLOD_indices(const Surface3DLOD * lod, unsigned char level, unsigned char mask)
+{
+    if (level > lod->max_level) {
+        fprintf(stderr, "Error: LOD level %u is above the max level %u.\n", level, lod->max_level);
+        exit(EXIT_FAILURE);
+    }
+
+    GridIndices * g = &lod->stitched[16 * level + (mask & 15)];
+
+    pthread_mutex_lock(&lod_lock);
+
+    if (!g->data)
+    {
+        unsigned int n = 1u << level;
+        g->count = Surface3DLOD_gather(lod, level, mask & 15, NULL);
+        g->index_size = ((n + 1) * (n + 1) <= 65536) ? 2 : 4;
+        g->EBO = 0;
+
+        unsigned int * indices = (unsigned int *) malloc((size_t) g->count * sizeof(unsigned int));
+        if (!indices) {
+            fprintf(stderr, "Error: Memory allocation failed for LOD index buffer.\n");
+            exit(EXIT_FAILURE);
+        }
+        Surface3DLOD_gather(lod, level, mask & 15, indices);
+
+        if (g->index_size == 2)
+        {
+            unsigned short * data = (unsigned short *) malloc((size_t) g->count * sizeof(unsigned short));
+            if (!data) {
+                fprintf(stderr, "Error: Memory allocation failed for LOD index buffer.\n");
+                exit(EXIT_FAILURE);
+            }
+            for (unsigned int k = 0; k < g->count; k++)
+                data[k] = (unsigned short) indices[k];
+
+            free(indices);
+            g->data = data;
+        }
+        else
+            g->data = indices;
+    }
+
+    pthread_mutex_unlock(&lod_lock);
+    return g;
+}
+
+// bilinear interpolation of a plane between the corners of the cell of a coarser grid
+static float plane_bilerp(const float * p, unsigned int stride, unsigned int ci, unsigned int cj, unsigned int step, float a, float b)
+{
+    float p00 = p[ci * stride + cj];
+    float p01 = p[ci * stride + cj + step];
+    float p10 = p[(ci + step) * stride + cj];
+    float p11 = p[(ci + step) * stride + cj + step];
+
+    return (1.0f - a) * ((1.0f - b) * p00 + b * p01) + a * ((1.0f - b) * p10 + b * p11);
+}
+
+Surface3DPatch * Surface3DPatch_init(
+    Vec3 ** control_points,
+    const unsigned int u_control_count,
+    const unsigned int v_control_count,
+    const enum methode mode_u,
+    const enum methode mode_v,
+    unsigned char max_level
+)
+{
+    if (max_level > SURFACE_LOD_MAX_LEVEL)
+        max_level = SURFACE_LOD_MAX_LEVEL;
+
+    Surface3DPatch * p = (Surface3DPatch *) calloc(1, sizeof(Surface3DPatch));
+    if (!p) {
+        fprintf(stderr, "Error: Memory allocation failed for Surface3DPatch.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    p->u_control_count = u_control_count;
+    p->v_control_count = v_control_count;
+    p->mode_u = mode_u;
+    p->mode_v = mode_v;
+    p->max_level = max_level;
+
+    p->control_points = copy_controls(NULL, control_points, u_control_count, v_control_count);
+    p->errors = (float *) calloc(max_level + 1, sizeof(float));
+    if (!p->errors) {
+        fprintf(stderr, "Error: Memory allocation failed for Surface3DPatch.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    unsigned int n = 1u << max_level;
+    Surface3D * s = Surface3D_init(p->control_points, u_control_count, v_control_count, n + 1, n + 1, mode_u, mode_v);
+    if (!s)
+        exit(EXIT_FAILURE);
+
+    //sphère englobante : centre de la boite englobante des échantillons
+    Vec3 lo = { s->x[0], s->y[0], s->z[0] };
+    Vec3 hi = lo;
+    for (unsigned int i = 0; i <= n; i++)
+        for (unsigned int j = 0; j <= n; j++)
+        {
+            unsigned int k = i * s->stride + j;
+            lo.x = fminf(lo.x, s->x[k]); hi.x = fmaxf(hi.x, s->x[k]);
+            lo.y = fminf(lo.y, s->y[k]); hi.y = fmaxf(hi.y, s->y[k]);
+            lo.z = fminf(lo.z, s->z[k]); hi.z = fmaxf(hi.z, s->z[k]);
+        }
+    Vec3_set(&p->center, 0.5f * (lo.x + hi.x), 0.5f * (lo.y + hi.y), 0.5f * (lo.z + hi.z));
+
+    float r2 = 0.0f;
+    for (unsigned int i = 0; i <= n; i++)
+        for (unsigned int j = 0; j <= n; j++)
+        {
+            unsigned int k = i * s->stride + j;
+            float dx = s->x[k] - p->center.x;
+            float dy = s->y[k] - p->center.y;
+            float dz = s->z[k] - p->center.z;
+            r2 = fmaxf(r2, dx * dx + dy * dy + dz * dz);
+        }
+    p->radius = sqrtf(r2);
+
+    //erreur de chaque niveau : distance max entre la surface fine et la grille du niveau
+    p->errors[max_level] = 0.0f;
+    for (int level = (int) max_level - 1; level >= 0; level--)
+    {
+        unsigned int step = 1u << (max_level - level);
+        float e2 = 0.0f;
+
+        for (unsigned int i = 0; i <= n; i++)
+        {
+            unsigned int ci = (i / step) * step;
+            if (ci == n) ci -= step;
+            float a = (float) (i - ci) / (float) step;
+
+            for (unsigned int j = 0; j <= n; j++)
+            {
+                unsigned int cj = (j / step) * step;
+                if (cj == n) cj -= step;
+                float b = (float) (j - cj) / (float) step;
+
+                unsigned int k = i * s->stride + j;
+                float dx = s->x[k] - plane_bilerp(s->x, s->stride, ci, cj, step, a, b);
+                float dy = s->y[k] - plane_bilerp(s->y, s->stride, ci, cj, step, a, b);
+                float dz = s->z[k] - plane_bilerp(s->z, s->stride, ci, cj, step, a, b);
+                e2 = fmaxf(e2, dx * dx + dy * dy + dz * dz);
+            }
+        }
+
+        //a coarser level never has a smaller error
+        p->errors[level] = fmaxf(sqrtf(e2), p->errors[level + 1]);
+    }
+
+    Surface3D_free(s);
+
+    p->level = 0;
+    p->mask = 0;
+
+    return p;
+}
+
+float Surface3DPatch_pixelScale(float viewport_height, float fov_y)
+{
+    return viewport_height / (2.0f * tanf(0.5f * fov_y));
+}
+
+void Surface3DPatch_selectLevels(Surface3DPatch ** patches, unsigned int rows, unsigned int cols, Vec3 * eye, float pixel_scale, float tolerance)
+{
+    unsigned int n_patches = rows * cols;
+
+    //niveau le plus grossier dont l'erreur projetée reste sous la tolérance
+    for (unsigned int k = 0; k < n_patches; k++)
+    {
+        Surface3DPatch * p = patches[k];
+        float d = Vec3_dist(eye, &p->center) - p->radius;
+        if (d < 1e-4f)
+            d = 1e-4f;
+
+        p->level = p->max_level;
+        for (unsigned char level = 0; level <= p->max_level; level++)
+            if (p->errors[level] * pixel_scale / d <= tolerance)
+            {
+                p->level = level;
+                break;
+            }
+    }
+
+    //les voisins diffèrent d'au plus un niveau : on raffine jusqu'à stabilité
+    unsigned char changed = 1;
+    while (changed)
+    {
+        changed = 0;
+        for (unsigned int r = 0; r < rows; r++)
+            for (unsigned int c = 0; c < cols; c++)
+            {
+                Surface3DPatch * p = patches[r * cols + c];
+                Surface3DPatch * nb[4] = {
+                    (r > 0) ? patches[(r - 1) * cols + c] : NULL,
+                    (r + 1 < rows) ? patches[(r + 1) * cols + c] : NULL,
+                    (c > 0) ? patches[r * cols + c - 1] : NULL,
+                    (c + 1 < cols) ? patches[r * cols + c + 1] : NULL
+                };
+
+                for (unsigned char e = 0; e < 4; e++)
+                    if (nb[e] && nb[e]->level > p->level + 1 && p->max_level >= nb[e]->level - 1)
+                    {
+                        p->level = nb[e]->level - 1;
+                        changed = 1;
+                    }
+            }
+    }
+
+    for (unsigned int r = 0; r < rows; r++)
+        for (unsigned int c = 0; c < cols; c++)
+        {
+            Surface3DPatch * p = patches[r * cols + c];
+            Surface3DPatch * nb[4] = {
+                (r > 0) ? patches[(r - 1) * cols + c] : NULL,
+                (r + 1 < rows) ? patches[(r + 1) * cols + c] : NULL,
+                (c > 0) ? patches[r * cols + c - 1] : NULL,
+                (c + 1 < cols) ? patches[r * cols + c + 1] : NULL
+            };
+
+            p->mask = 0;
+            for (unsigned char e = 0; e < 4; e++)
+                if (nb[e] && nb[e]->level < p->level)
+                    p->mask |= (unsigned char) (1 << e);
+        }
+}
+
+Object * Surface3DPatch_objectify(const Surface3DPatch * p, const Surface3DLOD * lod, Vec3 * color, Vec3 * specular_color, float shininess, float reflection)
+{
+    unsigned int n = 1u << p->level;
+
+    Surface3D * s = Surface3D_init(p->control_points, p->u_control_count, p->v_control_count, n + 1, n + 1, p->mode_u, p->mode_v);
+    if (!s)
+        exit(EXIT_FAILURE);
+
+    Object * obj = Surface3D_obejctify(s, color, specular_color, shininess, reflection);
+    Surface3D_free(s);
+
+    //triangles partagés du niveau et du masque à la place de la grille complète
+    obj->grid = Surface3DLOD_indices(lod, p->level, p->mask);
+    obj->n_faces = obj->grid->count / 3;
+
+    return obj;
+}
+
+
+#define HEIGHTMAP_TAPS 4
+
+typedef struct heightmap_args
+{
+    const Matrix * h;
+    unsigned int rows, cols;        //samples of the whole grid
+    unsigned int r0, c0;            //first sample of the tile
+    unsigned int tile_rows, tile_cols;
+    Vec3 * size;
+    unsigned int * xi, * yi;        //texels used by each column / row of the grid (HEIGHTMAP_TAPS each)
+    float * wx, * wy;               //their weights
+    float * heights;                //samples of the tile with a border of one sample, (tile_rows + 2) x (tile_cols + 2)
+    Object * obj;
+    StandardVertexFormat::Vertex material;
+} heightmap_args;
+
+// texels and weights of the n samples of a grid spread over n_texels
+static void heightmap_taps(unsigned int n, unsigned int n_texels, enum heightmap_filter filter, unsigned int * idx, float * w)
+{
+    for (unsigned int k = 0; k < n; k++)
+    {
+        float X = (n > 1) ? (float) k / (float) (n - 1) * (float) (n_texels - 1) : 0.0f;
+        int x0 = (int) floorf(X);
+        float t = X - (float) x0;
+
+        float weights[HEIGHTMAP_TAPS] = { 0.0f, 0.0f, 0.0f, 0.0f };
+        if (filter == HEIGHTMAP_BICUBIC)
+        {
+            float t2 = t * t, t3 = t2 * t;
+            weights[0] = 0.5f * (-t3 + 2.0f * t2 - t);
+            weights[1] = 0.5f * (3.0f * t3 - 5.0f * t2 + 2.0f);
+            weights[2] = 0.5f * (-3.0f * t3 + 4.0f * t2 + t);
+            weights[3] = 0.5f * (t3 - t2);
+        }
+        else
+        {
+            weights[1] = 1.0f - t;
+            weights[2] = t;
+        }
+
+        for (int l = 0; l < HEIGHTMAP_TAPS; l++)
+        {
+            int x = x0 - 1 + l;
+            if (x < 0) x = 0;
+            if (x > (int) n_texels - 1) x = (int) n_texels - 1;
+
+            idx[k * HEIGHTMAP_TAPS + l] = (unsigned int) x;
+            w[k * HEIGHTMAP_TAPS + l] = weights[l];
+        }
+    }
+}
+
+static unsigned int clamp_sample(long k, unsigned int n)
+{
+    if (k < 0)
+        return 0;
+    if (k > (long) n - 1)
+        return n - 1;
+    return (unsigned int) k;
+}
+
+// filtered heights of the rows [begin, end[ of the bordered tile
+static void thread_fn_heights(unsigned int begin, unsigned int end, void * args)
+{
+    heightmap_args * h_args = (heightmap_args *) args;
+    const Matrix * h = h_args->h;
+    unsigned int width = h_args->tile_cols + 2;
+
+    for (unsigned int b = begin; b < end; b++)
+    {
+        unsigned int gi = clamp_sample((long) h_args->r0 + b - 1, h_args->rows);
+        const unsigned int * yi = h_args->yi + gi * HEIGHTMAP_TAPS;
+        const float * wy = h_args->wy + gi * HEIGHTMAP_TAPS;
+        float * out = h_args->heights + (size_t) b * width;
+
+        for (unsigned int c = 0; c < width; c++)
+            out[c] = 0.0f;
+
+        for (unsigned int k = 0; k < HEIGHTMAP_TAPS; k++)
+        {
+            if (wy[k] == 0.0f)
+                continue;
+
+            const float * texels = h->data + (size_t) yi[k] * h->n_cols;
+
+            for (unsigned int c = 0; c < width; c++)
+            {
+                unsigned int gj = clamp_sample((long) h_args->c0 + c - 1, h_args->cols);
+                const unsigned int * xi = h_args->xi + gj * HEIGHTMAP_TAPS;
+                const float * wx = h_args->wx + gj * HEIGHTMAP_TAPS;
+
+                out[c] += wy[k] * (wx[0] * texels[xi[0]] + wx[1] * texels[xi[1]] + wx[2] * texels[xi[2]] + wx[3] * texels[xi[3]]);
+            }
+        }
+    }
+}
+
+// vertices of the rows [begin, end[ of the tile, normals from the neighbor samples
+static void thread_fn_heightmapRows(unsigned int begin, unsigned int end, void * args)
+{
+    heightmap_args * h_args = (heightmap_args *) args;
+    Vec3 * size = h_args->size;
+    unsigned int width = h_args->tile_cols + 2;
+    float dx = (h_args->cols > 1) ? size->x / (float) (h_args->cols - 1) : 0.0f;
+    float dz = (h_args->rows > 1) ? size->z / (float) (h_args->rows - 1) : 0.0f;
+
+    for (unsigned int i = begin; i < end; i++)
+    {
+        unsigned int gi = h_args->r0 + i;
+        const float * up = h_args->heights + (size_t) i * width;
+        const float * row = up + width;
+        const float * down = row + width;
+
+        //one sided differences on the borders of the whole grid
+        float span_z = (float) (clamp_sample((long) gi + 1, h_args->rows) - clamp_sample((long) gi - 1, h_args->rows)) * dz;
+        float z = (float) gi * dz;
+
+        StandardVertexFormat::Vertex * v = StandardVertexFormat::vertices(h_args->obj) + (size_t) i * h_args->tile_cols;
+
+        for (unsigned int j = 0; j < h_args->tile_cols; j++)
+        {
+            unsigned int gj = h_args->c0 + j;
+            float span_x = (float) (clamp_sample((long) gj + 1, h_args->cols) - clamp_sample((long) gj - 1, h_args->cols)) * dx;
+
+            float dhdx = (span_x > 0.0f) ? size->y * (row[j + 2] - row[j]) / span_x : 0.0f;
+            float dhdz = (span_z > 0.0f) ? size->y * (down[j + 1] - up[j + 1]) / span_z : 0.0f;
+            float inv = 1.0f / sqrtf(dhdx * dhdx + 1.0f + dhdz * dhdz);
+
+            v[j] = h_args->material;
+            v[j].set<0>((float) gj * dx, size->y * row[j + 1], z);
+            v[j].set<1>(-dhdx * inv, inv, -dhdz * inv);
+        }
+    }
+}
+
+// object of the samples [r0, r0 + tile_rows[ x [c0, c0 + tile_cols[
+static Object * heightmap_tile(heightmap_args * h_args, unsigned int r0, unsigned int c0, unsigned int tile_rows, unsigned int tile_cols)
+{
+    h_args->r0 = r0;
+    h_args->c0 = c0;
+    h_args->tile_rows = tile_rows;
+    h_args->tile_cols = tile_cols;
+    h_args->obj = StandardVertexFormat::initGrid(tile_rows * tile_cols, Object_gridIndices(tile_rows, tile_cols, GRID_OPEN, 0));
+
+    ThreadPool_parallelFor(0, tile_rows + 2, 16, thread_fn_heights, (void *) h_args);
+    ThreadPool_parallelFor(0, tile_rows, 16, thread_fn_heightmapRows, (void *) h_args);
+    Object_computeBounds(h_args->obj);
+
+    return h_args->obj;
+}
+
+static void heightmap_prepare(heightmap_args * h_args, const Matrix * h, unsigned int rows, unsigned int cols, unsigned int max_tile_rows, unsigned int max_tile_cols,
+ Vec3 * size, enum heightmap_filter filter, Vec3 * color, Vec3 * specular_color, float shininess, float reflection)
+{
+    if (!h || !h->data || !size || rows < 2 || cols < 2) {
+        fprintf(stderr, "Error: Invalid input arguments for heightmap.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    h_args->h = h;
+    h_args->rows = rows;
+    h_args->cols = cols;
+    h_args->size = size;
+    h_args->material = StandardVertex_material(color, specular_color, shininess, reflection);
+
+    h_args->xi = (unsigned int *) calloc((size_t) cols * HEIGHTMAP_TAPS, sizeof(unsigned int));
+    h_args->wx = (float *) calloc((size_t) cols * HEIGHTMAP_TAPS, sizeof(float));
+    h_args->yi = (unsigned int *) calloc((size_t) rows * HEIGHTMAP_TAPS, sizeof(unsigned int));
+    h_args->wy = (float *) calloc((size_t) rows * HEIGHTMAP_TAPS, sizeof(float));
+    h_args->heights = (float *) calloc((size_t) (max_tile_rows + 2) * (max_tile_cols + 2), sizeof(float));
+    if (!h_args->xi || !h_args->wx || !h_args->yi || !h_args->wy || !h_args->heights) {
+        fprintf(stderr, "Error: Memory allocation failed for heightmap.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    heightmap_taps(cols, h->n_cols, filter, h_args->xi, h_args->wx);
+    heightmap_taps(rows, h->n_rows, filter, h_args->yi, h_args->wy);
+}
+
+static void heightmap_release(heightmap_args * h_args)
+{
+    free(h_args->xi);
+    free(h_args->wx);
+    free(h_args->yi);
+    free(h_args->wy);
+    free(h_args->heights);
+}
+
+Object * Surface3D_heightmap(const Matrix * h, unsigned int rows, unsigned int cols, Vec3 * size, enum heightmap_filter filter,
+ Vec3 * color, Vec3 * specular_color, float shininess, float reflection)
+{
+    heightmap_args h_args;
+    heightmap_prepare(&h_args, h, rows, cols, rows, cols, size, filter, color, specular_color, shininess, reflection);
+
+    Object * obj = heightmap_tile(&h_args, 0, 0, rows, cols);
+
+    heightmap_release(&h_args);
+    return obj;
+}
+
+Object ** Surface3D_heightmapTiles(const Matrix * h, unsigned int rows, unsigned int cols, unsigned short tile, Vec3 * size, enum heightmap_filter filter,
+ Vec3 * color, Vec3 * specular_color, float shininess, float reflection, unsigned int * n_tiles)
+{
+    if (tile == 0 || !n_tiles) {
+        fprintf(stderr, "Error: Invalid input arguments for heightmap tiles.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    heightmap_args h_args;
+    heightmap_prepare(&h_args, h, rows, cols, tile + 1, tile + 1, size, filter, color, specular_color, shininess, reflection);
+
+    //les tuiles voisines partagent leur ligne / colonne de bord
+    unsigned int tiles_z = (rows - 1 + tile - 1) / tile;
+    unsigned int tiles_x = (cols - 1 + tile - 1) / tile;
+    *n_tiles = tiles_z * tiles_x;
+
+    Object ** tiles = (Object **) calloc(*n_tiles, sizeof(Object *));
+    if (!tiles) {
+        fprintf(stderr, "Error: Memory allocation failed for heightmap tiles.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (unsigned int a = 0; a < tiles_z; a++)
+        for (unsigned int b = 0; b < tiles_x; b++)
+        {
+            unsigned int r0 = a * tile;
+            unsigned int c0 = b * tile;
+            unsigned int tile_rows = ((rows - 1 - r0 < tile) ? rows - 1 - r0 : tile) + 1;
+            unsigned int tile_cols = ((cols - 1 - c0 < tile) ? cols - 1 - c0 : tile) + 1;
+
+            tiles[a * tiles_x + b] = heightmap_tile(&h_args, r0, c0, tile_rows, tile_cols);
+        }
+
+    heightmap_release(&h_args);
+    return tiles;
 }
\ No newline at end of file
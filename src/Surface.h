@@ -1,57 +1,289 @@
-/**
- * @file Surface.h
- * @brief Header for struct Surface
- * @author Antony Madaleno
- * @version 1.0
- * @date 09-11-2023
- *
- * Header pour les struct Surface
- *
- */
-
-#pragma once
-
-#include "Curve.h"
-#include "Vec.h"
-#include "Quaternion.h"
-#include "Object.h"
-
-
-/**
- * @struct Surface3D
- */
-typedef struct Surface3D
-{
-    float * data;
-    Vec3 ** Tu;
-    Vec3 ** Tv;
-    Vec3 ** normals;
-    unsigned short N, M; //the number of points evaluated on u, v
-} Surface3D;
-
-/**
- * @brief initialize a surface given the following paramaters
- * @param Vec3 ** control_points the controls points defining the surface
- * etc..
- */
-Surface3D * Surface3D_init( 
-    Vec3 ** control_points,
-    const unsigned char u_control_count,
-    const unsigned char v_control_count,
-    const unsigned short u_count, 
-    const unsigned short v_count, 
-    const enum methode mode_u, 
-    const enum methode mode_v
-);
-
-/**
- * @brief 
- * 
- * @param s 
- * @param color 
- * @param specular_color 
- * @param shininess 
- * @param reflection 
- * @return Object* 
- */
-Object * Surface3D_obejctify(Surface3D * s, Vec3 * color, Vec3 * specular_color, float shininess, float reflection);
\ No newline at end of file
+/**
+ * @file Surface.h
+ * @brief Header for struct Surface
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 09-11-2023
+ *
+ * Header pour les struct Surface
+ *
+ */
+
+#pragma once
+
+#include "Curve.h"
+#include "Vec.h"
+#include "Quaternion.h"
+#include "Object.h"
+
+
+/**
+ * @struct Surface3D
+ * @brief evaluated surface stored as planes (one float per sample and per component),
+ * the sample (i, j) of a plane is at index i * stride + j
+ */
+typedef struct Surface3D
+{
+    float * block;              //single 64 bytes aligned allocation holding every plane
+    float * x, * y, * z;        //positions
+    float * nx, * ny, * nz;     //unit dS/du x dS/dv
+    float * tux, * tuy, * tuz;  //dS/du (not normalized, so that control point moves stay linear)
+    float * tvx, * tvy, * tvz;  //dS/dv
+    unsigned int stride;        //floats from a row to the next (M rounded up to 64 bytes)
+    unsigned short N, M; //the number of points evaluated on u, v
+    Vec3 ** control_points;     //copy of the control points, control_points[v][u]
+    unsigned int u_control_count, v_control_count;
+    enum methode mode_u, mode_v;
+    Arena * arena;              //arena of the surface and its planes (see Arena_begin), NULL for the heap
+} Surface3D;
+
+/**
+ * @struct Surface3DRect
+ * @brief samples [i0, i1[ x [j0, j1[ of a surface, empty when i0 == i1
+ */
+typedef struct Surface3DRect
+{
+    unsigned short i0, i1;
+    unsigned short j0, j1;
+} Surface3DRect;
+
+/**
+ * @brief initialize a surface given the following paramaters, from the arena of the current scope if any
+ * @param Vec3 ** control_points the controls points defining the surface
+ * etc..
+ */
+Surface3D * Surface3D_init( 
+    Vec3 ** control_points,
+    const unsigned int u_control_count,
+    const unsigned int v_control_count,
+    const unsigned short u_count, 
+    const unsigned short v_count, 
+    const enum methode mode_u, 
+    const enum methode mode_v
+);
+
+/**
+ * @brief free a surface, its planes and its control points,
+ * nothing is done for a surface created in an arena scope (see Arena_begin), it goes with the arena
+ * 
+ * @param s 
+ */
+void Surface3D_free(Surface3D * s);
+
+/**
+ * @brief 
+ * 
+ * @param s 
+ * @param color 
+ * @param specular_color 
+ * @param shininess 
+ * @param reflection 
+ * @return Object* 
+ */
+Object * Surface3D_obejctify(Surface3D * s, Vec3 * color, Vec3 * specular_color, float shininess, float reflection);
+
+/**
+ * @brief move the control point (u, v) and update only the samples it influences :
+ * S, dS/du and dS/dv get the outer product of the basis columns u and v times the move, then the normals of the rectangle are recomputed
+ * 
+ * @param s 
+ * @param u index of the control point in u
+ * @param v index of the control point in v
+ * @param p new position
+ * @return Surface3DRect the samples that changed
+ */
+Surface3DRect Surface3D_updateControlPoint(Surface3D * s, unsigned int u, unsigned int v, Vec3 * p);
+
+/**
+ * @brief rewrite the positions and normals of the vertices of a rectangle in an object made by Surface3D_obejctify
+ * the bounds of the object only grow (see Object_growBounds)
+ * 
+ * @param s 
+ * @param obj 
+ * @param rect 
+ * @return Curve3DRange the vertices to upload (see Buffer_updateRange)
+ */
+Curve3DRange Surface3D_updateObject(Surface3D * s, Object * obj, Surface3DRect rect);
+
+#define SURFACE_LOD_MAX_LEVEL 8     //257 x 257 samples
+
+/**
+ * @brief edges of a patch grid, a bit is set in a mask when the neighbor across the edge is one level coarser
+ */
+#define SURFACE_EDGE_U0 1   //row i = 0
+#define SURFACE_EDGE_U1 2   //row i = n
+#define SURFACE_EDGE_V0 4   //column j = 0
+#define SURFACE_EDGE_V1 8   //column j = n
+
+/**
+ * @struct Surface3DLODLevel
+ * @brief triangles of the (2^level + 1)^2 grid of a level, split in ranges so any edge can be stitched
+ */
+typedef struct Surface3DLODLevel
+{
+    unsigned int * indices;     //interior cells then, for each edge, its full strip and its stitched strip
+    unsigned int first[9];      //range 0 is the interior, range 1 + 2 * edge + stitched is a strip
+    unsigned int count[9];
+} Surface3DLODLevel;
+
+/**
+ * @struct Surface3DLOD
+ * @brief index buffers of every level, they only depend on the grid so they are shared by all the patches
+ */
+typedef struct Surface3DLOD
+{
+    unsigned char max_level;
+    Surface3DLODLevel * levels;
+    GridIndices * stitched;     //triangles of each level and mask (level * 16 + mask), built on first request
+} Surface3DLOD;
+
+/**
+ * @struct Surface3DPatch
+ * @brief a patch of a patch set with the geometric error of each level and its bounding sphere
+ */
+typedef struct Surface3DPatch
+{
+    Vec3 ** control_points;     //copy of the control points
+    unsigned int u_control_count, v_control_count;
+    enum methode mode_u, mode_v;
+    unsigned char max_level;
+    float * errors;             //max distance between the surface and the grid of each level
+    Vec3 center;
+    float radius;
+    unsigned char level;        //level chosen by the last selection
+    unsigned char mask;         //edges stitched to a coarser neighbor (SURFACE_EDGE_*)
+} Surface3DPatch;
+
+/**
+ * @brief build the index buffers of the levels 0 to max_level
+ * 
+ * @param max_level at most SURFACE_LOD_MAX_LEVEL
+ * @return Surface3DLOD* 
+ */
+Surface3DLOD * Surface3DLOD_init(unsigned char max_level);
+
+/**
+ * @brief copy the triangles of a level with the edges of mask stitched to the level below
+ * 
+ * @param lod 
+ * @param level 
+ * @param mask SURFACE_EDGE_* bits
+ * @param indices destination, NULL to only get the count
+ * @return unsigned int number of indices
+ */
+unsigned int Surface3DLOD_gather(const Surface3DLOD * lod, unsigned char level, unsigned char mask, unsigned int * indices);
+
+/**
+ * @brief return the cached triangles of a level with the edges of mask stitched, built on first request
+ * and never modified afterwards : every patch with the same level and mask draws the same index buffer
+ * 
+ * @param lod 
+ * @param level 
+ * @param mask SURFACE_EDGE_* bits
+ * @return GridIndices* rows, cols and wrap are 0 : not a plain grid
+ */
+GridIndices * Surface3DLOD_indices(const Surface3DLOD * lod, unsigned char level, unsigned char mask);
+
+/**
+ * @brief evaluate a patch at its finest level to measure the error of every level and its bounds
+ * 
+ * @param control_points 
+ * @param u_control_count 
+ * @param v_control_count 
+ * @param mode_u 
+ * @param mode_v 
+ * @param max_level at most SURFACE_LOD_MAX_LEVEL
+ * @return Surface3DPatch* 
+ */
+Surface3DPatch * Surface3DPatch_init(
+    Vec3 ** control_points,
+    const unsigned int u_control_count,
+    const unsigned int v_control_count,
+    const enum methode mode_u,
+    const enum methode mode_v,
+    unsigned char max_level
+);
+
+/**
+ * @brief number of pixels covered by one unit at distance one, for a viewport height and a vertical field of view
+ * 
+ * @param viewport_height in pixels
+ * @param fov_y in radians
+ * @return float 
+ */
+float Surface3DPatch_pixelScale(float viewport_height, float fov_y);
+
+/**
+ * @brief pick the coarsest level of each patch whose projected error stays under tolerance pixels,
+ * then refine patches so that neighbors differ by one level at most and set the stitching masks.
+ * patches[r * cols + c] share their row i = 0 with patches[(r - 1) * cols + c] and their column j = 0 with patches[r * cols + c - 1]
+ * 
+ * @param patches 
+ * @param rows 
+ * @param cols 
+ * @param eye camera position
+ * @param pixel_scale see Surface3DPatch_pixelScale
+ * @param tolerance in pixels
+ */
+void Surface3DPatch_selectLevels(Surface3DPatch ** patches, unsigned int rows, unsigned int cols, Vec3 * eye, float pixel_scale, float tolerance);
+
+/**
+ * @brief evaluate a patch at its selected level, with the shared triangles of its level and mask (see Surface3DLOD_indices)
+ * 
+ * @param p 
+ * @param lod 
+ * @param color 
+ * @param specular_color 
+ * @param shininess 
+ * @param reflection 
+ * @return Object* 
+ */
+Object * Surface3DPatch_objectify(const Surface3DPatch * p, const Surface3DLOD * lod, Vec3 * color, Vec3 * specular_color, float shininess, float reflection);
+
+
+/**
+ * @brief reconstruction filter of a heightmap between its texels
+ */
+enum heightmap_filter
+{
+    HEIGHTMAP_BILINEAR,
+    HEIGHTMAP_BICUBIC       //Catmull-Rom, goes through the texels
+};
+
+/**
+ * @brief mesh a heightfield on a rows x cols grid : the sample (i, j) is at x = j / (cols - 1) * size->x, z = i / (rows - 1) * size->z
+ * and y = size->y * h, h being filtered from the plane (its columns along x, its rows along z). Normals are central differences of the samples.
+ * 
+ * @param h height plane (a channel of an Image, or Image_luminance)
+ * @param rows number of samples along z
+ * @param cols number of samples along x
+ * @param size extent on x and z, y scales the heights
+ * @param filter 
+ * @param color 
+ * @param specular_color 
+ * @param shininess 
+ * @param reflection 
+ * @return Object* 
+ */
+Object * Surface3D_heightmap(const Matrix * h, unsigned int rows, unsigned int cols, Vec3 * size, enum heightmap_filter filter,
+ Vec3 * color, Vec3 * specular_color, float shininess, float reflection);
+
+/**
+ * @brief same grid as Surface3D_heightmap cut in tiles of tile x tile quads, each tile being its own object (for culling).
+ * Neighbor tiles share their edge samples, equal tiles share their indices. Tiles are ordered row by row.
+ * 
+ * @param h 
+ * @param rows 
+ * @param cols 
+ * @param tile quads per tile side (255 keeps 16 bits indices)
+ * @param size 
+ * @param filter 
+ * @param color 
+ * @param specular_color 
+ * @param shininess 
+ * @param reflection 
+ * @param n_tiles number of objects returned
+ * @return Object** 
+ */
+Object ** Surface3D_heightmapTiles(const Matrix * h, unsigned int rows, unsigned int cols, unsigned short tile, Vec3 * size, enum heightmap_filter filter,
+ Vec3 * color, Vec3 * specular_color, float shininess, float reflection, unsigned int * n_tiles);
\ No newline at end of file
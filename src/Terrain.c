@@ -0,0 +1,392 @@
+#include "Terrain.h"
+#include "VertexFormat.hpp"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <float.h>
+
+static_assert(TerrainVertexFormat::words == TERRAIN_VERTEX_SIZE, "terrain vertices are TERRAIN_VERTEX_SIZE floats");
+
+// height of the sample (i, j) of the heightmap, clamped on its borders
+static float sample_height(const Terrain * t, long i, long j)
+{
+    const Matrix * h = t->h;
+    if (i < 0) i = 0;
+    if (j < 0) j = 0;
+    if (i > (long) h->n_rows - 1) i = (long) h->n_rows - 1;
+    if (j > (long) h->n_cols - 1) j = (long) h->n_cols - 1;
+
+    return t->size.y * h->data[(size_t) i * h->n_cols + j];
+}
+
+// unit normal from central differences with a spacing of s samples
+static void sample_normal(const Terrain * t, long i, long j, long s, float * n)
+{
+    const Matrix * h = t->h;
+    float dx = t->size.x / (float) (h->n_cols - 1);
+    float dz = t->size.z / (float) (h->n_rows - 1);
+
+    long jl = (j - s < 0) ? 0 : j - s;
+    long jr = (j + s > (long) h->n_cols - 1) ? (long) h->n_cols - 1 : j + s;
+    long iu = (i - s < 0) ? 0 : i - s;
+    long id = (i + s > (long) h->n_rows - 1) ? (long) h->n_rows - 1 : i + s;
+
+    float dhdx = (jr > jl) ? (sample_height(t, i, jr) - sample_height(t, i, jl)) / ((float) (jr - jl) * dx) : 0.0f;
+    float dhdz = (id > iu) ? (sample_height(t, id, j) - sample_height(t, iu, j)) / ((float) (id - iu) * dz) : 0.0f;
+    float inv = 1.0f / sqrtf(dhdx * dhdx + 1.0f + dhdz * dhdz);
+
+    n[0] = -dhdx * inv;
+    n[1] = inv;
+    n[2] = -dhdz * inv;
+}
+
+static void chunk_release(TerrainChunk * c)
+{
+    Terrain * t = c->terrain;
+
+    if (t->on_evict)
+        t->on_evict(c);
+
+    size_t bytes = (size_t) c->object->n_points * TERRAIN_VERTEX_SIZE * sizeof(float);
+    __atomic_fetch_sub(&t->used, bytes, __ATOMIC_ACQ_REL);
+
+    Object_free(c->object);
+
+    c->object = NULL;
+    c->user = NULL;
+    c->min_y = t->min_y;
+    c->max_y = t->max_y;
+    __atomic_store_n(&c->state, TERRAIN_CHUNK_EMPTY, __ATOMIC_RELEASE);
+}
+
+// run by a worker : vertices of a chunk and their morph targets (the surface of the next level at the same x, z)
+static void thread_fn_chunk(void * args)
+{
+    TerrainChunk * c = (TerrainChunk *) args;
+    Terrain * t = c->terrain;
+    const Matrix * h = t->h;
+
+    unsigned int n = t->chunk + 1;
+    long s = 1L << c->level;
+    long i0 = (long) c->z * t->chunk * s;
+    long j0 = (long) c->x * t->chunk * s;
+    float dx = t->size.x / (float) (h->n_cols - 1);
+    float dz = t->size.z / (float) (h->n_rows - 1);
+
+    Object * obj = TerrainVertexFormat::initGrid(n * n, t->grid);
+    TerrainVertexFormat::Vertex * vertices = TerrainVertexFormat::vertices(obj);
+
+    float min_y = FLT_MAX, max_y = -FLT_MAX;
+
+    for (unsigned int i = 0; i < n; i++)
+    {
+        long gi = i0 + (long) i * s;
+        if (gi > (long) h->n_rows - 1) gi = (long) h->n_rows - 1;
+
+        for (unsigned int j = 0; j < n; j++)
+        {
+            long gj = j0 + (long) j * s;
+            if (gj > (long) h->n_cols - 1) gj = (long) h->n_cols - 1;
+
+            TerrainVertexFormat::Vertex * v = vertices + (size_t) i * n + j;
+            float y = sample_height(t, gi, gj);
+            float normal[3];
+
+            //POSITION
+            v->set<0>((float) gj * dx, y, (float) gi * dz);
+
+            //NORMAL
+            sample_normal(t, gi, gj, s, normal);
+            v->copy<1>(normal);
+
+            //COLORS PARAMETERS
+            v->set<2>(t->color.x, t->color.y, t->color.z);
+            v->set<3>(t->specular_color.x, t->specular_color.y, t->specular_color.z);
+            v->set<4>(t->shininess);
+            v->set<5>(t->reflection);
+
+            //MORPH : les sommets impairs rejoignent l'arête (ou la diagonale) de la grille deux fois plus grossière
+            unsigned char odd_i = i & 1, odd_j = j & 1;
+            if (odd_i && odd_j)
+                v->set<6>(0.5f * (sample_height(t, gi - s, gj - s) + sample_height(t, gi + s, gj + s)));
+            else if (odd_i)
+                v->set<6>(0.5f * (sample_height(t, gi - s, gj) + sample_height(t, gi + s, gj)));
+            else if (odd_j)
+                v->set<6>(0.5f * (sample_height(t, gi, gj - s) + sample_height(t, gi, gj + s)));
+            else
+                v->set<6>(y);
+
+            sample_normal(t, gi, gj, 2 * s, normal);
+            v->copy<7>(normal);
+
+            min_y = fminf(min_y, y);
+            max_y = fmaxf(max_y, y);
+        }
+    }
+
+    //the box of the chunk is known from its grid and the heights met in the loop
+    long last_i = i0 + (long) (n - 1) * s, last_j = j0 + (long) (n - 1) * s;
+    if (last_i > (long) h->n_rows - 1) last_i = (long) h->n_rows - 1;
+    if (last_j > (long) h->n_cols - 1) last_j = (long) h->n_cols - 1;
+    float box_min[3] = { (float) j0 * dx, min_y, (float) i0 * dz };
+    float box_max[3] = { (float) last_j * dx, max_y, (float) last_i * dz };
+    Object_setBounds(obj, box_min, box_max, 0.0f);
+
+    c->object = obj;
+    c->min_y = min_y;
+    c->max_y = max_y;
+    __atomic_fetch_add(&t->used, (size_t) n * n * TERRAIN_VERTEX_SIZE * sizeof(float), __ATOMIC_ACQ_REL);
+
+    __atomic_store_n(&c->state, TERRAIN_CHUNK_READY, __ATOMIC_RELEASE);
+}
+
+Terrain * Terrain_init(const Matrix * h, Vec3 * size, unsigned short chunk, unsigned char n_levels, float lod_distance, size_t budget,
+ Vec3 * color, Vec3 * specular_color, float shininess, float reflection)
+{
+    if (!h || !h->data || h->n_cols < 2 || h->n_rows < 2 || !size || chunk < 2 || (chunk & 1)
+        || n_levels == 0 || n_levels > TERRAIN_MAX_LEVELS || lod_distance <= 0.0f) {
+        fprintf(stderr, "Error: Invalid input arguments for terrain.\n");
+        return NULL;
+    }
+
+    Terrain * t = (Terrain *) calloc(1, sizeof(Terrain));
+    if (!t) {
+        fprintf(stderr, "Error: Memory allocation failed for Terrain.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    t->h = h;
+    t->size = *size;
+    t->chunk = chunk;
+    t->n_levels = n_levels;
+    t->budget = budget;
+    t->used = 0;
+    t->frame = 0;
+    t->color = *color;
+    t->specular_color = *specular_color;
+    t->shininess = shininess;
+    t->reflection = reflection;
+    t->on_evict = NULL;
+    TaskGroup_init(&t->pending);
+
+    //toutes les chunks partagent la même grille
+    t->grid = Object_gridIndices(chunk + 1, chunk + 1, GRID_OPEN, 0);
+
+    t->min_y = FLT_MAX;
+    t->max_y = -FLT_MAX;
+    for (size_t k = 0; k < (size_t) h->n_cols * h->n_rows; k++)
+    {
+        t->min_y = fminf(t->min_y, size->y * h->data[k]);
+        t->max_y = fmaxf(t->max_y, size->y * h->data[k]);
+    }
+
+    unsigned int quads_x = h->n_cols - 1;
+    unsigned int quads_z = h->n_rows - 1;
+
+    for (unsigned char l = 0; l < n_levels; l++)
+    {
+        unsigned long span = (unsigned long) chunk << l;
+        t->ranges[l] = lod_distance * (float) (1u << l);
+        t->n_x[l] = (unsigned int) ((quads_x + span - 1) / span);
+        t->n_z[l] = (unsigned int) ((quads_z + span - 1) / span);
+
+        t->chunks[l] = (TerrainChunk *) calloc((size_t) t->n_x[l] * t->n_z[l], sizeof(TerrainChunk));
+        if (!t->chunks[l]) {
+            fprintf(stderr, "Error: Memory allocation failed for terrain chunks.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        for (unsigned int z = 0; z < t->n_z[l]; z++)
+            for (unsigned int x = 0; x < t->n_x[l]; x++)
+            {
+                TerrainChunk * c = &t->chunks[l][z * t->n_x[l] + x];
+                c->terrain = t;
+                c->level = l;
+                c->x = x;
+                c->z = z;
+                c->state = TERRAIN_CHUNK_EMPTY;
+                c->min_y = t->min_y;
+                c->max_y = t->max_y;
+            }
+    }
+
+    return t;
+}
+
+static float chunk_distance(const Terrain * t, const TerrainChunk * c, Vec3 * eye)
+{
+    float dx = t->size.x / (float) (t->h->n_cols - 1);
+    float dz = t->size.z / (float) (t->h->n_rows - 1);
+    unsigned long span = (unsigned long) t->chunk << c->level;
+
+    float x0 = (float) (c->x * span) * dx, x1 = fminf((float) ((c->x + 1) * span) * dx, t->size.x);
+    float z0 = (float) (c->z * span) * dz, z1 = fminf((float) ((c->z + 1) * span) * dz, t->size.z);
+
+    //the heights of a chunk are written by its worker : they are read once it is ready, those of the terrain before
+    float min_y = t->min_y, max_y = t->max_y;
+    if (__atomic_load_n(&c->state, __ATOMIC_ACQUIRE) == TERRAIN_CHUNK_READY)
+    {
+        min_y = c->min_y;
+        max_y = c->max_y;
+    }
+
+    float ex = fmaxf(fmaxf(x0 - eye->x, 0.0f), eye->x - x1);
+    float ey = fmaxf(fmaxf(min_y - eye->y, 0.0f), eye->y - max_y);
+    float ez = fmaxf(fmaxf(z0 - eye->z, 0.0f), eye->z - z1);
+
+    return sqrtf(ex * ex + ey * ey + ez * ez);
+}
+
+static void chunk_request(Terrain * t, TerrainChunk * c)
+{
+    c->last_used = t->frame;
+
+    if (__atomic_load_n(&c->state, __ATOMIC_ACQUIRE) != TERRAIN_CHUNK_EMPTY)
+        return;
+
+    c->state = TERRAIN_CHUNK_PENDING;
+    ThreadPool_submit(ThreadPool_get(), &t->pending, thread_fn_chunk, (void *) c);
+}
+
+static void select_node(Terrain * t, TerrainChunk * c, Vec3 * eye, TerrainChunk ** selected, unsigned int max_selected, unsigned int * count)
+{
+    unsigned char l = c->level;
+    unsigned char subdivide = l > 0 && chunk_distance(t, c, eye) < t->ranges[l - 1];
+
+    if (subdivide)
+    {
+        TerrainChunk * children[4];
+        unsigned char n_children = 0;
+        unsigned char children_ready = 1;
+
+        for (unsigned int dz = 0; dz < 2; dz++)
+            for (unsigned int dx = 0; dx < 2; dx++)
+            {
+                unsigned int x = 2 * c->x + dx, z = 2 * c->z + dz;
+                if (x >= t->n_x[l - 1] || z >= t->n_z[l - 1])
+                    continue;
+
+                TerrainChunk * child = &t->chunks[l - 1][z * t->n_x[l - 1] + x];
+                chunk_request(t, child);
+                if (__atomic_load_n(&child->state, __ATOMIC_ACQUIRE) != TERRAIN_CHUNK_READY)
+                    children_ready = 0;
+                children[n_children++] = child;
+            }
+
+        //le parent n'est gardé que pour remplacer des enfants pas encore prêts
+        unsigned char ready = 0;
+        if (!children_ready)
+        {
+            chunk_request(t, c);
+            ready = __atomic_load_n(&c->state, __ATOMIC_ACQUIRE) == TERRAIN_CHUNK_READY;
+        }
+
+        if (!ready)
+        {
+            for (unsigned char k = 0; k < n_children; k++)
+                select_node(t, children[k], eye, selected, max_selected, count);
+            return;
+        }
+    }
+    else
+    {
+        chunk_request(t, c);
+    }
+
+    if (__atomic_load_n(&c->state, __ATOMIC_ACQUIRE) != TERRAIN_CHUNK_READY || *count >= max_selected)
+        return;
+
+    //les sommets atteignent leur cible au bout de la portée du niveau, le dernier niveau ne se transforme pas
+    float inner = (l > 0) ? t->ranges[l - 1] : 0.0f;
+    if (l + 1 < t->n_levels)
+    {
+        c->morph_end = t->ranges[l];
+        c->morph_start = inner + 0.7f * (t->ranges[l] - inner);
+    }
+    else
+    {
+        c->morph_start = FLT_MAX;
+        c->morph_end = FLT_MAX;
+    }
+
+    selected[(*count)++] = c;
+}
+
+static int compare_last_used(const void * a, const void * b)
+{
+    const TerrainChunk * ca = * (TerrainChunk * const *) a;
+    const TerrainChunk * cb = * (TerrainChunk * const *) b;
+    return (ca->last_used > cb->last_used) - (ca->last_used < cb->last_used);
+}
+
+// free the least recently used chunks that were not used this frame until the budget is met
+static void terrain_evict(Terrain * t)
+{
+    if (__atomic_load_n(&t->used, __ATOMIC_ACQUIRE) <= t->budget)
+        return;
+
+    size_t n_chunks = 0;
+    for (unsigned char l = 0; l < t->n_levels; l++)
+        n_chunks += (size_t) t->n_x[l] * t->n_z[l];
+
+    TerrainChunk ** candidates = (TerrainChunk **) calloc(n_chunks, sizeof(TerrainChunk *));
+    if (!candidates) {
+        fprintf(stderr, "Error: Memory allocation failed for terrain eviction.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    size_t n = 0;
+    for (unsigned char l = 0; l < t->n_levels; l++)
+        for (size_t k = 0; k < (size_t) t->n_x[l] * t->n_z[l]; k++)
+        {
+            TerrainChunk * c = &t->chunks[l][k];
+            if (c->last_used != t->frame && __atomic_load_n(&c->state, __ATOMIC_ACQUIRE) == TERRAIN_CHUNK_READY)
+                candidates[n++] = c;
+        }
+
+    qsort(candidates, n, sizeof(TerrainChunk *), compare_last_used);
+
+    for (size_t k = 0; k < n && __atomic_load_n(&t->used, __ATOMIC_ACQUIRE) > t->budget; k++)
+        chunk_release(candidates[k]);
+
+    free(candidates);
+}
+
+unsigned int Terrain_select(Terrain * t, Vec3 * eye, TerrainChunk ** selected, unsigned int max_selected)
+{
+    t->frame++;
+
+    unsigned char top = t->n_levels - 1;
+    unsigned int count = 0;
+
+    for (unsigned int z = 0; z < t->n_z[top]; z++)
+        for (unsigned int x = 0; x < t->n_x[top]; x++)
+            select_node(t, &t->chunks[top][z * t->n_x[top] + x], eye, selected, max_selected, &count);
+
+    terrain_evict(t);
+
+    return count;
+}
+
+void Terrain_wait(Terrain * t)
+{
+    ThreadPool_wait(ThreadPool_get(), &t->pending);
+}
+
+void Terrain_free(Terrain * t)
+{
+    if (!t)
+        return;
+
+    Terrain_wait(t);
+
+    for (unsigned char l = 0; l < t->n_levels; l++)
+    {
+        for (size_t k = 0; k < (size_t) t->n_x[l] * t->n_z[l]; k++)
+            if (t->chunks[l][k].state == TERRAIN_CHUNK_READY)
+                chunk_release(&t->chunks[l][k]);
+        free(t->chunks[l]);
+    }
+
+    free(t);
+}
\ No newline at end of file
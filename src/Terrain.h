@@ -0,0 +1,120 @@
+/**
+ * @file Terrain.h
+ * @brief Header for struct Terrain
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 19-10-2026
+ *
+ * Header pour le terrain découpé en chunks (quadtree de niveaux de détail)
+ *
+ */
+
+#pragma once
+
+#include <pthread.h>
+#include <stddef.h>
+
+#include "Vec.h"
+#include "Matrix.h"
+#include "Object.h"
+#include "ThreadPool.h"
+
+#define TERRAIN_MAX_LEVELS 16
+
+/**
+ * @brief vertex of a chunk : the 14 floats of the other objects, then the height and normal it morphs to
+ */
+#define TERRAIN_VERTEX_SIZE 18
+
+#define TERRAIN_CHUNK_EMPTY 0
+#define TERRAIN_CHUNK_PENDING 1     //queued or being generated by a worker
+#define TERRAIN_CHUNK_READY 2
+
+struct Terrain;
+
+/**
+ * @struct TerrainChunk
+ * @brief node of the quadtree, a level l chunk covers chunk * 2^l quads of the heightmap with chunk quads
+ */
+typedef struct TerrainChunk
+{
+    struct Terrain * terrain;
+    unsigned char level;
+    unsigned int x, z;                  //position among the chunks of its level
+    volatile unsigned char state;
+    Object * object;                    //(chunk + 1)^2 vertices of TERRAIN_VERTEX_SIZE floats, NULL unless ready
+    float min_y, max_y;                 //height bounds, written by the worker : read them only once the chunk is ready
+    float morph_start, morph_end;       //distances to the eye where the vertices go from their height to their morph target
+    unsigned int last_used;             //frame of the last selection
+    void * user;                        //free for the renderer (its Buffer...)
+} TerrainChunk;
+
+/**
+ * @struct Terrain
+ */
+typedef struct Terrain
+{
+    const Matrix * h;                   //heights, one vertex per texel at level 0
+    Vec3 size;                          //extent on x and z, y scales the heights
+    unsigned short chunk;               //quads per chunk side (even)
+    unsigned char n_levels;
+    float ranges[TERRAIN_MAX_LEVELS];   //distance up to which a level is used
+    unsigned int n_x[TERRAIN_MAX_LEVELS], n_z[TERRAIN_MAX_LEVELS];
+    TerrainChunk * chunks[TERRAIN_MAX_LEVELS];  //chunks[level][z * n_x + x]
+    GridIndices * grid;                 //triangles shared by every chunk
+    float min_y, max_y;
+
+    size_t budget;                      //bytes of vertices kept at most
+    volatile size_t used;
+    unsigned int frame;
+    TaskGroup pending;
+
+    Vec3 color, specular_color;
+    float shininess, reflection;
+
+    void (*on_evict)(TerrainChunk * chunk);     //called before the object of a chunk is freed (can be NULL)
+} Terrain;
+
+/**
+ * @brief create the quadtree of a heightmap, no chunk is generated yet
+ *
+ * @param h heights (kept, not copied)
+ * @param size extent on x and z, y scales the heights
+ * @param chunk quads per chunk side, even (254 keeps 16 bits indices)
+ * @param n_levels levels of the quadtree, each one halves the resolution of the previous
+ * @param lod_distance distance up to which level 0 is used, it doubles at each level
+ * @param budget bytes of vertices kept in memory
+ * @param color
+ * @param specular_color
+ * @param shininess
+ * @param reflection
+ * @return Terrain*
+ */
+Terrain * Terrain_init(const Matrix * h, Vec3 * size, unsigned short chunk, unsigned char n_levels, float lod_distance, size_t budget,
+ Vec3 * color, Vec3 * specular_color, float shininess, float reflection);
+
+/**
+ * @brief choose the chunks to draw from the eye position, missing chunks are queued on the workers
+ * and replaced by their parent until they are ready, then evict unused chunks above the budget
+ *
+ * @param t
+ * @param eye
+ * @param selected ready chunks to draw, with their morph distances
+ * @param max_selected size of selected
+ * @return unsigned int number of selected chunks
+ */
+unsigned int Terrain_select(Terrain * t, Vec3 * eye, TerrainChunk ** selected, unsigned int max_selected);
+
+/**
+ * @brief wait for the chunks being generated
+ *
+ * @param t
+ */
+void Terrain_wait(Terrain * t);
+
+/**
+ * @brief wait for the workers and free every chunk (on_evict is called for each)
+ *
+ * @param t
+ */
+void Terrain_free(Terrain * t);
\ No newline at end of file
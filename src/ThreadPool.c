@@ -0,0 +1,375 @@
+#include "ThreadPool.h"
+#include "Arena.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sched.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+typedef struct worker_args
+{
+    ThreadPool * pool;
+    unsigned int id;
+} worker_args;
+
+typedef struct range_task
+{
+    ThreadPool_rangeFn fn;
+    void * args;
+    unsigned int begin;
+    unsigned int end;
+} range_task;
+
+//worker identity of the current thread (-1 if it is not a worker)
+static __thread ThreadPool * tp_owner = NULL;
+static __thread int tp_worker = -1;
+
+static ThreadPool * shared_pool = NULL;
+static pthread_once_t shared_once = PTHREAD_ONCE_INIT;
+
+unsigned int ThreadPool_hardwareConcurrency()
+{
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    long n = (long) info.dwNumberOfProcessors;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (n > 0) ? (unsigned int) n : 1;
+}
+
+static void deque_init(TaskDeque * d)
+{
+    pthread_mutex_init(&d->lock, NULL);
+    d->capacity = 64;
+    d->top = 0;
+    d->bottom = 0;
+    d->tasks = (Task *) calloc(d->capacity, sizeof(Task));
+    if (!d->tasks) {
+        fprintf(stderr, "Error: Memory allocation failed for task deque.\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void deque_push(TaskDeque * d, Task * t)
+{
+    pthread_mutex_lock(&d->lock);
+
+    if (d->bottom - d->top == d->capacity)
+    {
+        Task * tasks = (Task *) calloc(d->capacity * 2, sizeof(Task));
+        if (!tasks) {
+            fprintf(stderr, "Error: Memory allocation failed for task deque.\n");
+            exit(EXIT_FAILURE);
+        }
+
+        for (unsigned int i = 0; i < d->capacity; i++)
+            tasks[i] = d->tasks[(d->top + i) % d->capacity];
+
+        free(d->tasks);
+        d->tasks = tasks;
+        d->top = 0;
+        d->bottom = d->capacity;
+        d->capacity *= 2;
+    }
+
+    d->tasks[d->bottom % d->capacity] = *t;
+    d->bottom++;
+
+    pthread_mutex_unlock(&d->lock);
+}
+
+//the owner take the most recent task (better cache locality)
+static unsigned char deque_pop(TaskDeque * d, Task * t)
+{
+    unsigned char found = 0;
+    pthread_mutex_lock(&d->lock);
+
+    if (d->bottom != d->top)
+    {
+        d->bottom--;
+        *t = d->tasks[d->bottom % d->capacity];
+        found = 1;
+    }
+
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+//thieves take the oldest task (usually the biggest remaining work)
+static unsigned char deque_steal(TaskDeque * d, Task * t)
+{
+    unsigned char found = 0;
+    pthread_mutex_lock(&d->lock);
+
+    if (d->bottom != d->top)
+    {
+        *t = d->tasks[d->top % d->capacity];
+        d->top++;
+        found = 1;
+    }
+
+    pthread_mutex_unlock(&d->lock);
+    return found;
+}
+
+static unsigned char take_task(ThreadPool * pool, Task * t)
+{
+    if (__atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) == 0)
+        return 0;
+
+    int self = (tp_owner == pool) ? tp_worker : -1;
+
+    if (self >= 0 && deque_pop(&pool->deques[self], t))
+    {
+        __atomic_fetch_sub(&pool->queued, 1, __ATOMIC_ACQ_REL);
+        return 1;
+    }
+
+    unsigned int start = (self >= 0) ? (unsigned int) self + 1 : 0;
+    for (unsigned int k = 0; k < pool->n_workers; k++)
+    {
+        if (deque_steal(&pool->deques[(start + k) % pool->n_workers], t))
+        {
+            __atomic_fetch_sub(&pool->queued, 1, __ATOMIC_ACQ_REL);
+            return 1;
+        }
+    }
+
+    return 0;
+}
+
+static void run_task(Task * t)
+{
+    //a task waited on inside an arena scope may run on the waiting thread : it must still allocate from the heap,
+    //its objects (terrain chunks...) outlive the scope of the thread that happens to run it
+    Arena_begin(NULL);
+    t->fn(t->args);
+    Arena_end();
+
+    if (t->group)
+        __atomic_fetch_sub(&t->group->pending, 1, __ATOMIC_ACQ_REL);
+}
+
+static void * thread_worker(void * args)
+{
+    worker_args * w = (worker_args *) args;
+    ThreadPool * pool = w->pool;
+    tp_owner = pool;
+    tp_worker = (int) w->id;
+    free(w);
+
+    Task t;
+    while (1)
+    {
+        if (take_task(pool, &t))
+        {
+            run_task(&t);
+            continue;
+        }
+
+        pthread_mutex_lock(&pool->sleep_lock);
+        while (!pool->stop && __atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) == 0)
+            pthread_cond_wait(&pool->sleep_cond, &pool->sleep_lock);
+
+        unsigned char done = pool->stop && __atomic_load_n(&pool->queued, __ATOMIC_ACQUIRE) == 0;
+        pthread_mutex_unlock(&pool->sleep_lock);
+
+        if (done)
+            break;
+    }
+
+    return NULL;
+}
+
+ThreadPool * ThreadPool_init(unsigned int n_workers)
+{
+    ThreadPool * pool = (ThreadPool *) calloc(1, sizeof(ThreadPool));
+    if (!pool) {
+        fprintf(stderr, "Error: Memory allocation failed for thread pool.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    //the thread that waits on a group also runs tasks, so keep one core for it
+    if (n_workers == 0)
+    {
+        unsigned int hw = ThreadPool_hardwareConcurrency();
+        n_workers = (hw > 1) ? hw - 1 : 1;
+    }
+
+    pool->n_workers = n_workers;
+    pool->queued = 0;
+    pool->next = 0;
+    pool->stop = 0;
+    pthread_mutex_init(&pool->sleep_lock, NULL);
+    pthread_cond_init(&pool->sleep_cond, NULL);
+
+    pool->deques = (TaskDeque *) calloc(n_workers, sizeof(TaskDeque));
+    pool->threads = (pthread_t *) calloc(n_workers, sizeof(pthread_t));
+    if (!pool->deques || !pool->threads) {
+        fprintf(stderr, "Error: Memory allocation failed for thread pool workers.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    for (unsigned int i = 0; i < n_workers; i++)
+        deque_init(&pool->deques[i]);
+
+    for (unsigned int i = 0; i < n_workers; i++)
+    {
+        worker_args * w = (worker_args *) calloc(1, sizeof(worker_args));
+        if (!w) {
+            fprintf(stderr, "Error: Memory allocation failed for worker arguments.\n");
+            exit(EXIT_FAILURE);
+        }
+        w->pool = pool;
+        w->id = i;
+        pthread_create(&pool->threads[i], NULL, thread_worker, (void *) w);
+    }
+
+    return pool;
+}
+
+static void shared_pool_create()
+{
+    shared_pool = ThreadPool_init(0);
+}
+
+ThreadPool * ThreadPool_get()
+{
+    pthread_once(&shared_once, shared_pool_create);
+    return shared_pool;
+}
+
+void ThreadPool_free(ThreadPool * pool)
+{
+    if (!pool)
+        return;
+
+    pthread_mutex_lock(&pool->sleep_lock);
+    pool->stop = 1;
+    pthread_cond_broadcast(&pool->sleep_cond);
+    pthread_mutex_unlock(&pool->sleep_lock);
+
+    for (unsigned int i = 0; i < pool->n_workers; i++)
+        pthread_join(pool->threads[i], NULL);
+
+    for (unsigned int i = 0; i < pool->n_workers; i++)
+    {
+        pthread_mutex_destroy(&pool->deques[i].lock);
+        free(pool->deques[i].tasks);
+    }
+
+    pthread_mutex_destroy(&pool->sleep_lock);
+    pthread_cond_destroy(&pool->sleep_cond);
+
+    if (pool == shared_pool)
+        shared_pool = NULL;
+
+    free(pool->deques);
+    free(pool->threads);
+    free(pool);
+}
+
+void TaskGroup_init(TaskGroup * group)
+{
+    __atomic_store_n(&group->pending, 0, __ATOMIC_RELEASE);
+}
+
+void ThreadPool_submit(ThreadPool * pool, TaskGroup * group, ThreadPool_taskFn fn, void * args)
+{
+    Task t;
+    t.fn = fn;
+    t.args = args;
+    t.group = group;
+
+    if (group)
+        __atomic_fetch_add(&group->pending, 1, __ATOMIC_ACQ_REL);
+
+    //workers push on their own deque, other threads spread the tasks
+    unsigned int d;
+    if (tp_owner == pool && tp_worker >= 0)
+        d = (unsigned int) tp_worker;
+    else
+        d = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED) % pool->n_workers;
+
+    deque_push(&pool->deques[d], &t);
+    __atomic_fetch_add(&pool->queued, 1, __ATOMIC_ACQ_REL);
+
+    pthread_mutex_lock(&pool->sleep_lock);
+    pthread_cond_signal(&pool->sleep_cond);
+    pthread_mutex_unlock(&pool->sleep_lock);
+}
+
+void ThreadPool_wait(ThreadPool * pool, TaskGroup * group)
+{
+    Task t;
+    while (__atomic_load_n(&group->pending, __ATOMIC_ACQUIRE) > 0)
+    {
+        if (take_task(pool, &t))
+            run_task(&t);
+        else
+            sched_yield();
+    }
+}
+
+static void thread_range(void * args)
+{
+    range_task * r = (range_task *) args;
+    r->fn(r->begin, r->end, r->args);
+}
+
+void ThreadPool_parallelFor(unsigned int begin, unsigned int end, unsigned int grain, ThreadPool_rangeFn fn, void * args)
+{
+    if (end <= begin)
+        return;
+
+    ThreadPool * pool = ThreadPool_get();
+    unsigned int n = end - begin;
+
+    //by default a few chunks per thread so the stealing can balance the load
+    if (grain == 0)
+    {
+        grain = n / (4 * (pool->n_workers + 1));
+        if (grain == 0)
+            grain = 1;
+    }
+
+    unsigned int n_chunks = (n + grain - 1) / grain;
+    if (n_chunks == 1)
+    {
+        fn(begin, end, args);
+        return;
+    }
+
+    range_task * chunks = (range_task *) calloc(n_chunks, sizeof(range_task));
+    if (!chunks) {
+        fprintf(stderr, "Error: Memory allocation failed for parallel for chunks.\n");
+        exit(EXIT_FAILURE);
+    }
+
+    TaskGroup group;
+    TaskGroup_init(&group);
+
+    for (unsigned int c = 0; c < n_chunks; c++)
+    {
+        chunks[c].fn = fn;
+        chunks[c].args = args;
+        chunks[c].begin = begin + c * grain;
+        chunks[c].end = (n - c * grain > grain) ? begin + (c + 1) * grain : end;
+    }
+
+    //the calling thread takes the first chunk itself
+    for (unsigned int c = 1; c < n_chunks; c++)
+        ThreadPool_submit(pool, &group, thread_range, (void *) &chunks[c]);
+
+    thread_range((void *) &chunks[0]);
+    ThreadPool_wait(pool, &group);
+
+    free(chunks);
+}
\ No newline at end of file
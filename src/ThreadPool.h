@@ -0,0 +1,134 @@
+/**
+ * @file ThreadPool.h
+ * @brief Header for struct ThreadPool
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 19-10-2026
+ *
+ * Header pour le pool de threads partagé (vol de tâches)
+ *
+ */
+
+#pragma once
+
+#include <pthread.h>
+
+/**
+ * @brief function executed by a task
+ */
+typedef void (*ThreadPool_taskFn)(void * args);
+
+/**
+ * @brief function executed on a sub range [begin, end[ by ThreadPool_parallelFor
+ */
+typedef void (*ThreadPool_rangeFn)(unsigned int begin, unsigned int end, void * args);
+
+/**
+ * @struct TaskGroup
+ * @brief counter of the tasks of a group that are not finished yet
+ */
+typedef struct TaskGroup
+{
+    volatile unsigned int pending;
+} TaskGroup;
+
+/**
+ * @struct Task
+ */
+typedef struct Task
+{
+    ThreadPool_taskFn fn;
+    void * args;
+    TaskGroup * group;
+} Task;
+
+/**
+ * @struct TaskDeque
+ * @brief double ended queue of a worker, the owner pop at the bottom the thieves steal at the top
+ */
+typedef struct TaskDeque
+{
+    pthread_mutex_t lock;
+    Task * tasks;
+    unsigned int capacity;
+    unsigned int top;
+    unsigned int bottom;
+} TaskDeque;
+
+/**
+ * @struct ThreadPool
+ */
+typedef struct ThreadPool
+{
+    unsigned int n_workers;
+    pthread_t * threads;
+    TaskDeque * deques;
+    volatile unsigned int queued;   //number of tasks waiting in the deques
+    volatile unsigned int next;     //round robin for submissions from outside the pool
+    volatile unsigned char stop;
+    pthread_mutex_t sleep_lock;
+    pthread_cond_t sleep_cond;
+} ThreadPool;
+
+/**
+ * @brief create a pool with n_workers threads
+ *
+ * @param n_workers number of workers, 0 to size it from the hardware
+ * @return ThreadPool*
+ */
+ThreadPool * ThreadPool_init(unsigned int n_workers);
+
+/**
+ * @brief return the shared pool of the process (created on first call, sized to the hardware)
+ *
+ * @return ThreadPool*
+ */
+ThreadPool * ThreadPool_get();
+
+/**
+ * @brief stop the workers and free the pool
+ *
+ * @param pool
+ */
+void ThreadPool_free(ThreadPool * pool);
+
+/**
+ * @brief number of logical cores of the machine
+ */
+unsigned int ThreadPool_hardwareConcurrency();
+
+/**
+ * @brief reset a task group before its first submission
+ *
+ * @param group
+ */
+void TaskGroup_init(TaskGroup * group);
+
+/**
+ * @brief push a task in the pool, it will be run by any worker
+ *
+ * @param pool
+ * @param group group to notify when the task is done (can be NULL)
+ * @param fn
+ * @param args
+ */
+void ThreadPool_submit(ThreadPool * pool, TaskGroup * group, ThreadPool_taskFn fn, void * args);
+
+/**
+ * @brief wait for every task of the group, the calling thread run pending tasks meanwhile
+ *
+ * @param pool
+ * @param group
+ */
+void ThreadPool_wait(ThreadPool * pool, TaskGroup * group);
+
+/**
+ * @brief call fn on chunks of at most grain indices covering [begin, end[ using the shared pool, return once every chunk is done
+ *
+ * @param begin first index
+ * @param end   last index (excluded)
+ * @param grain size of a chunk (0 to let the pool decide)
+ * @param fn    function called on each chunk
+ * @param args  arguments given to fn
+ */
+void ThreadPool_parallelFor(unsigned int begin, unsigned int end, unsigned int grain, ThreadPool_rangeFn fn, void * args);
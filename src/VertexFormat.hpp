@@ -0,0 +1,265 @@
+/**
+ * @file VertexFormat.hpp
+ * @brief Header for the template VertexFormat
+ * @author Antony Madaleno
+ * @version 1.0
+ * @date 19-10-2026
+ *
+ * Header pour les formats de sommets connus à la compilation (taille, décalages et écriture typée)
+ *
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "Vec.h"
+#include "Object.h"
+
+/**
+ * @brief kinds of attribute, each fills whole 4 bytes words like the ATTRIBUTE_* storages of Object
+ * layout is the value of Object.layout, stored the number of values written in the vertex
+ */
+template <unsigned char N>
+struct VertexFloat
+{
+    typedef float value_type;
+    static constexpr unsigned char type = ATTRIBUTE_FLOAT;
+    static constexpr unsigned char layout = N;
+    static constexpr unsigned char stored = N;
+    static constexpr unsigned int words = N;
+};
+
+template <unsigned char N>
+struct VertexSnorm16
+{
+    typedef short value_type;
+    static constexpr unsigned char type = ATTRIBUTE_SNORM16;
+    static constexpr unsigned char layout = N;
+    static constexpr unsigned char stored = N;
+    static constexpr unsigned int words = (N + 1) / 2;
+};
+
+struct VertexOct16
+{
+    typedef short value_type;
+    static constexpr unsigned char type = ATTRIBUTE_OCT16;
+    static constexpr unsigned char layout = 3;      //decoded to a vec3 by the shader
+    static constexpr unsigned char stored = 2;
+    static constexpr unsigned int words = 1;
+};
+
+template <unsigned char N>
+struct VertexUnorm8
+{
+    static_assert(N >= 1 && N <= 4, "8 bits attributes have 1 to 4 components");
+    typedef unsigned char value_type;
+    static constexpr unsigned char type = ATTRIBUTE_UNORM8;
+    static constexpr unsigned char layout = N;
+    static constexpr unsigned char stored = N;
+    static constexpr unsigned int words = 1;
+};
+
+// attribute I of a list, and the number of words before it
+template <unsigned int I, typename A, typename... Rest>
+struct VertexAttributeAt
+{
+    typedef typename VertexAttributeAt<I - 1, Rest...>::type type;
+    static constexpr unsigned int offset = A::words + VertexAttributeAt<I - 1, Rest...>::offset;
+};
+
+template <typename A, typename... Rest>
+struct VertexAttributeAt<0, A, Rest...>
+{
+    typedef A type;
+    static constexpr unsigned int offset = 0;
+};
+
+template <typename... A>
+struct VertexWords;
+
+template <>
+struct VertexWords<>
+{
+    static constexpr unsigned int words = 0;
+    static constexpr bool all_float = true;
+};
+
+template <typename A, typename... Rest>
+struct VertexWords<A, Rest...>
+{
+    static constexpr unsigned int words = A::words + VertexWords<Rest...>::words;
+    static constexpr bool all_float = A::type == ATTRIBUTE_FLOAT && VertexWords<Rest...>::all_float;
+};
+
+/**
+ * @brief vertex made of the attributes A in this order, packed on 4 bytes words
+ *
+ * Format::Vertex is the packed vertex (sizeof == Format::stride), an Object of this format
+ * is seen as an array of them so the generators write at constant offsets :
+ *
+ *      StandardVertexFormat::Vertex * v = StandardVertexFormat::vertices(obj);
+ *      v[i].set<0>(x, y, z);
+ */
+template <typename... A>
+struct VertexFormat
+{
+    static constexpr unsigned char n_attributes = sizeof...(A);
+    static constexpr unsigned int words = VertexWords<A...>::words;
+    static constexpr size_t stride = words * sizeof(float);
+
+    template <unsigned int I>
+    struct attribute
+    {
+        static_assert(I < sizeof...(A), "attribute out of the format");
+        typedef typename VertexAttributeAt<I, A...>::type type;
+        static constexpr unsigned int offset = VertexAttributeAt<I, A...>::offset;     //in words
+    };
+
+    struct Vertex
+    {
+        float data[words];
+
+        // the values of the attribute I, as many as it stores
+        template <unsigned int I, typename... V>
+        void set(V... v)
+        {
+            typedef typename attribute<I>::type T;
+            static_assert(sizeof...(V) == T::stored, "wrong number of values for the attribute");
+            const typename T::value_type values[] = { static_cast<typename T::value_type>(v)... };
+            memcpy(reinterpret_cast<unsigned char *>(data + attribute<I>::offset), values, sizeof(values));
+        }
+
+        // the same from an array of T::stored values
+        template <unsigned int I>
+        void copy(const typename attribute<I>::type::value_type * values)
+        {
+            typedef typename attribute<I>::type T;
+            memcpy(reinterpret_cast<unsigned char *>(data + attribute<I>::offset), values, T::stored * sizeof(typename T::value_type));
+        }
+
+        template <unsigned int I>
+        typename attribute<I>::type::value_type get(unsigned int k) const
+        {
+            typename attribute<I>::type::value_type value;
+            memcpy(&value, reinterpret_cast<const unsigned char *>(data + attribute<I>::offset) + k * sizeof(value), sizeof(value));
+            return value;
+        }
+    };
+
+    static_assert(sizeof(Vertex) == stride, "a vertex must be packed");
+
+    /**
+     * @brief layout array for Object_init / Object_initGrid, from the arena of the current scope if any
+     */
+    static unsigned char * layout()
+    {
+        const unsigned char values[] = { A::layout... };
+        unsigned char * layout = (unsigned char *) Arena_alloc(Arena_current(), n_attributes, sizeof(unsigned char));
+        memcpy(layout, values, sizeof(values));
+        return layout;
+    }
+
+    /**
+     * @brief types array of Object, NULL when every attribute is a float
+     */
+    static unsigned char * types()
+    {
+        if (VertexWords<A...>::all_float)
+            return NULL;
+
+        const unsigned char values[] = { A::type... };
+        unsigned char * types = (unsigned char *) Arena_alloc(Arena_current(), n_attributes, sizeof(unsigned char));
+        memcpy(types, values, sizeof(values));
+        return types;
+    }
+
+    /**
+     * @brief true if the object stores its vertices in this format
+     */
+    static bool matches(const Object * obj)
+    {
+        const unsigned char layouts[] = { A::layout... };
+        const unsigned char kinds[] = { A::type... };
+
+        if (obj->n_attributes != n_attributes)
+            return false;
+
+        for (unsigned char i = 0; i < n_attributes; i++)
+            if (obj->layout[i] != layouts[i] || (obj->types ? obj->types[i] : ATTRIBUTE_FLOAT) != kinds[i])
+                return false;
+
+        return true;
+    }
+
+    /**
+     * @brief vertices of an object of this format
+     */
+    static Vertex * vertices(Object * obj)
+    {
+        if (!matches(obj)) {
+            fprintf(stderr, "Error: The object does not have the expected vertex format.\n");
+            exit(EXIT_FAILURE);
+        }
+        return reinterpret_cast<Vertex *>(obj->vertexBuffer);
+    }
+
+    /**
+     * @brief calls f(index, type, stored, offset, stride) for each attribute in order, offset in words and stride in bytes
+     *
+     * the attribute setup of the GL buffers is generated from it, see Buffer.cpp
+     */
+    template <typename F>
+    static void forEachAttribute(F f)
+    {
+        unsigned char index = 0;
+        unsigned int offset = 0;
+        const int expand[] = { (f(index++, A::type, A::stored, offset, (unsigned int) stride), offset += A::words, 0)... };
+        (void) expand;
+    }
+
+    /**
+     * @brief object of this format whose triangles are shared grid indices
+     */
+    static Object * initGrid(unsigned int n_points, GridIndices * grid)
+    {
+        Object * obj = Object_initGrid(n_points, n_attributes, layout(), grid);
+        obj->types = types();
+        return obj;
+    }
+};
+
+//position, normal, color, specular, shininess, reflection : the vertices of every generator
+typedef VertexFormat< VertexFloat<3>, VertexFloat<3>, VertexFloat<3>, VertexFloat<3>, VertexFloat<1>, VertexFloat<1> > StandardVertexFormat;
+
+//position and normal, see Object_compact
+typedef VertexFormat< VertexFloat<3>, VertexFloat<3> > CompactVertexFormat;
+
+//see Object_quantize
+typedef VertexFormat< VertexSnorm16<3>, VertexOct16, VertexUnorm8<3>, VertexUnorm8<3>, VertexFloat<1>, VertexFloat<1> > QuantizedVertexFormat;
+typedef VertexFormat< VertexSnorm16<3>, VertexOct16 > QuantizedCompactVertexFormat;
+
+//standard vertex followed by the height and the normal of the parent level, see Terrain
+typedef VertexFormat< VertexFloat<3>, VertexFloat<3>, VertexFloat<3>, VertexFloat<3>, VertexFloat<1>, VertexFloat<1>, VertexFloat<1>, VertexFloat<3> > TerrainVertexFormat;
+
+static_assert(StandardVertexFormat::words == VERTEX_SIZE, "standard vertices are VERTEX_SIZE floats");
+static_assert(CompactVertexFormat::words == VERTEX_COMPACT_SIZE, "compact vertices are VERTEX_COMPACT_SIZE floats");
+static_assert(QuantizedVertexFormat::stride == 28 && QuantizedCompactVertexFormat::stride == 12, "quantized vertices are 28 and 12 bytes");
+
+/**
+ * @brief standard vertex holding only a material (position and normal are 0), generators copy it then set them
+ */
+inline StandardVertexFormat::Vertex StandardVertex_material(const Vec3 * color, const Vec3 * specular, float shininess, float reflection)
+{
+    StandardVertexFormat::Vertex v;
+    v.set<0>(0.0f, 0.0f, 0.0f);
+    v.set<1>(0.0f, 0.0f, 0.0f);
+    v.set<2>(color->x, color->y, color->z);
+    v.set<3>(specular->x, specular->y, specular->z);
+    v.set<4>(shininess);
+    v.set<5>(reflection);
+    return v;
+}
\ No newline at end of file